@@ -31,10 +31,13 @@
 
 #include "mongo/db/catalog/throttle_cursor.h"
 
+#include <algorithm>
+
 #include "mongo/db/catalog/validate_gen.h"
 #include "mongo/db/curop.h"
 #include "mongo/db/index/index_access_method.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/util/timer.h"
 
 namespace mongo {
 
@@ -42,6 +45,39 @@ namespace mongo {
 // 512KB.
 MONGO_FAIL_POINT_DEFINE(fixedCursorDataSizeOf512KBForDataThrottle);
 
+namespace {
+
+const uint64_t kBytesPerMB = 1024 * 1024;
+
+// A second in which less data than this was read is too small a sample to adapt to.
+const uint64_t kMinReadLatencySampleBytes = kBytesPerMB;
+
+// The read cost per MB must exceed its moving average by this factor before backing off.
+const double kReadLatencyBackoffFactor = 2.0;
+
+// Weight of the most recent second in the moving average of the read cost per MB.
+const double kReadLatencyAverageWeight = 0.1;
+
+// Backing off never lowers the adaptive limit below this rate.
+const uint64_t kMinAdaptiveBytesPerSec = kBytesPerMB;
+
+/**
+ * Starts timing a storage read, unless 'dataThrottle' does not adapt to read latency and so has no
+ * use for the read time.
+ */
+boost::optional<Timer> startReadTimer(OperationContext* opCtx, const DataThrottle& dataThrottle) {
+    if (!dataThrottle.shouldMeasureReadTime()) {
+        return boost::none;
+    }
+    return Timer(opCtx->getServiceContext()->getTickSource());
+}
+
+Microseconds readTime(const boost::optional<Timer>& timer) {
+    return timer ? timer->elapsed() : Microseconds(0);
+}
+
+}  // namespace
+
 SeekableRecordThrottleCursor::SeekableRecordThrottleCursor(OperationContext* opCtx,
                                                            const RecordStore* rs,
                                                            DataThrottle* dataThrottle) {
@@ -51,20 +87,22 @@ SeekableRecordThrottleCursor::SeekableRecordThrottleCursor(OperationContext* opC
 
 boost::optional<Record> SeekableRecordThrottleCursor::seekExact(OperationContext* opCtx,
                                                                 const RecordId& id) {
+    auto timer = startReadTimer(opCtx, *_dataThrottle);
     boost::optional<Record> record = _cursor->seekExact(id);
     if (record) {
         const int64_t dataSize = record->data.size() + sizeof(record->id.repr());
-        _dataThrottle->awaitIfNeeded(opCtx, dataSize);
+        _dataThrottle->awaitIfNeeded(opCtx, dataSize, readTime(timer));
     }
 
     return record;
 }
 
 boost::optional<Record> SeekableRecordThrottleCursor::next(OperationContext* opCtx) {
+    auto timer = startReadTimer(opCtx, *_dataThrottle);
     boost::optional<Record> record = _cursor->next();
     if (record) {
         const int64_t dataSize = record->data.size() + sizeof(record->id.repr());
-        _dataThrottle->awaitIfNeeded(opCtx, dataSize);
+        _dataThrottle->awaitIfNeeded(opCtx, dataSize, readTime(timer));
     }
 
     return record;
@@ -79,10 +117,11 @@ SortedDataInterfaceThrottleCursor::SortedDataInterfaceThrottleCursor(OperationCo
 
 boost::optional<IndexKeyEntry> SortedDataInterfaceThrottleCursor::seek(
     OperationContext* opCtx, const KeyString::Value& key) {
+    auto timer = startReadTimer(opCtx, *_dataThrottle);
     boost::optional<IndexKeyEntry> entry = _cursor->seek(key);
     if (entry) {
         const int64_t dataSize = entry->key.objsize() + sizeof(entry->loc.repr());
-        _dataThrottle->awaitIfNeeded(opCtx, dataSize);
+        _dataThrottle->awaitIfNeeded(opCtx, dataSize, readTime(timer));
     }
 
     return entry;
@@ -90,20 +129,22 @@ boost::optional<IndexKeyEntry> SortedDataInterfaceThrottleCursor::seek(
 
 boost::optional<KeyStringEntry> SortedDataInterfaceThrottleCursor::seekForKeyString(
     OperationContext* opCtx, const KeyString::Value& key) {
+    auto timer = startReadTimer(opCtx, *_dataThrottle);
     boost::optional<KeyStringEntry> entry = _cursor->seekForKeyString(key);
     if (entry) {
         const int64_t dataSize = entry->keyString.getSize() + sizeof(entry->loc.repr());
-        _dataThrottle->awaitIfNeeded(opCtx, dataSize);
+        _dataThrottle->awaitIfNeeded(opCtx, dataSize, readTime(timer));
     }
 
     return entry;
 }
 
 boost::optional<IndexKeyEntry> SortedDataInterfaceThrottleCursor::next(OperationContext* opCtx) {
+    auto timer = startReadTimer(opCtx, *_dataThrottle);
     boost::optional<IndexKeyEntry> entry = _cursor->next();
     if (entry) {
         const int64_t dataSize = entry->key.objsize() + sizeof(entry->loc.repr());
-        _dataThrottle->awaitIfNeeded(opCtx, dataSize);
+        _dataThrottle->awaitIfNeeded(opCtx, dataSize, readTime(timer));
     }
 
     return entry;
@@ -111,22 +152,43 @@ boost::optional<IndexKeyEntry> SortedDataInterfaceThrottleCursor::next(Operation
 
 boost::optional<KeyStringEntry> SortedDataInterfaceThrottleCursor::nextKeyString(
     OperationContext* opCtx) {
+    auto timer = startReadTimer(opCtx, *_dataThrottle);
     boost::optional<KeyStringEntry> entry = _cursor->nextKeyString();
     if (entry) {
         const int64_t dataSize = entry->keyString.getSize() + sizeof(entry->loc.repr());
-        _dataThrottle->awaitIfNeeded(opCtx, dataSize);
+        _dataThrottle->awaitIfNeeded(opCtx, dataSize, readTime(timer));
     }
 
     return entry;
 }
 
-void DataThrottle::awaitIfNeeded(OperationContext* opCtx, const int64_t dataSize) {
+DataThrottle::DataThrottle(OperationContext* opCtx)
+    : _startMillis(opCtx->getServiceContext()->getFastClockSource()->now().toMillisSinceEpoch()),
+      _bytesProcessed(0),
+      _totalElapsedTimeSec(0),
+      _totalMBProcessed(0),
+      _readTime(0),
+      _measureReadTime(gValidateThrottleOnReadLatency.load()),
+      _shouldNotThrottle(false) {}
+
+void DataThrottle::awaitIfNeeded(OperationContext* opCtx,
+                                 const int64_t dataSize,
+                                 Microseconds readTime) {
     int64_t currentMillis =
         opCtx->getServiceContext()->getFastClockSource()->now().toMillisSinceEpoch();
 
     // Reset the tracked information as the second has rolled over the starting point.
     if (currentMillis >= _startMillis + 1000) {
         float elapsedTimeSec = static_cast<float>(currentMillis - _startMillis) / 1000;
+
+        // Pick up changes to 'validateThrottleOnReadLatency' once per second rather than on every
+        // read.
+        _measureReadTime = gValidateThrottleOnReadLatency.load();
+
+        if (!_shouldNotThrottle) {
+            _adaptToReadLatency(_bytesProcessed, elapsedTimeSec);
+        }
+
         float mbProcessed = static_cast<float>(_bytesProcessed + dataSize) / 1024 / 1024;
 
         // Update how much data we've seen in the last second for CurOp.
@@ -140,8 +202,11 @@ void DataThrottle::awaitIfNeeded(OperationContext* opCtx, const int64_t dataSize
 
         _startMillis = currentMillis;
         _bytesProcessed = 0;
+        _readTime = Microseconds(0);
     }
 
+    _readTime += readTime;
+
     _bytesProcessed += MONGO_unlikely(fixedCursorDataSizeOf512KBForDataThrottle.shouldFail())
         ? /*512KB*/ 1 * 1024 * 512
         : dataSize;
@@ -150,8 +215,13 @@ void DataThrottle::awaitIfNeeded(OperationContext* opCtx, const int64_t dataSize
         return;
     }
 
-    // No throttling should take place if 'gMaxValidateMBperSec' is zero.
-    uint64_t maxValidateBytesPerSec = gMaxValidateMBperSec.load() * 1024 * 1024;
+    // No throttling should take place if 'gMaxValidateMBperSec' is zero and read latency
+    // adaptation has not imposed a limit.
+    uint64_t maxValidateBytesPerSec = gMaxValidateMBperSec.load() * kBytesPerMB;
+    if (_adaptiveMaxBytesPerSec != 0 &&
+        (maxValidateBytesPerSec == 0 || _adaptiveMaxBytesPerSec < maxValidateBytesPerSec)) {
+        maxValidateBytesPerSec = _adaptiveMaxBytesPerSec;
+    }
     if (maxValidateBytesPerSec == 0) {
         return;
     }
@@ -171,4 +241,40 @@ void DataThrottle::awaitIfNeeded(OperationContext* opCtx, const int64_t dataSize
     } while (currentMillis < _startMillis + 1000);
 }
 
+void DataThrottle::_adaptToReadLatency(uint64_t bytesProcessed, float elapsedTimeSec) {
+    if (!_measureReadTime) {
+        _adaptiveMaxBytesPerSec = 0;
+        _averageReadMicrosPerMB = 0;
+        return;
+    }
+
+    if (bytesProcessed < kMinReadLatencySampleBytes) {
+        return;
+    }
+
+    const double readMicrosPerMB =
+        static_cast<double>(durationCount<Microseconds>(_readTime)) * kBytesPerMB / bytesProcessed;
+    if (_averageReadMicrosPerMB == 0) {
+        _averageReadMicrosPerMB = readMicrosPerMB;
+        return;
+    }
+
+    const uint64_t bytesPerSec = static_cast<uint64_t>(bytesProcessed / elapsedTimeSec);
+    if (readMicrosPerMB > _averageReadMicrosPerMB * kReadLatencyBackoffFactor) {
+        // Storage reads have become markedly slower, so yield bandwidth to foreground operations.
+        if (_adaptiveMaxBytesPerSec == 0) {
+            _backoffBytesPerSec = bytesPerSec;
+        }
+        _adaptiveMaxBytesPerSec = std::max(kMinAdaptiveBytesPerSec, bytesPerSec / 2);
+    } else if (_adaptiveMaxBytesPerSec != 0) {
+        _adaptiveMaxBytesPerSec += _adaptiveMaxBytesPerSec / 4;
+        if (_adaptiveMaxBytesPerSec >= _backoffBytesPerSec) {
+            _adaptiveMaxBytesPerSec = 0;
+        }
+    }
+
+    _averageReadMicrosPerMB = (1 - kReadLatencyAverageWeight) * _averageReadMicrosPerMB +
+        kReadLatencyAverageWeight * readMicrosPerMB;
+}
+
 }  // namespace mongo
@@ -34,6 +34,7 @@
 
 #include "mongo/db/storage/record_store.h"
 #include "mongo/db/storage/sorted_data_interface.h"
+#include "mongo/util/duration.h"
 #include "mongo/util/fail_point.h"
 
 namespace mongo {
@@ -104,16 +105,15 @@ private:
  * Throttles the amount of data processed within a unit of time. Puts the thread to sleep via an
  * opCtx -- so it is interruptible -- whenever the data limit set by the 'maxValidateMBperSec'
  * server parameter is exceeded before the time unit is done.
+ *
+ * When the 'validateThrottleOnReadLatency' server parameter is enabled, the limit also adapts to
+ * the time spent reading from storage: a read cost per MB well above the recently observed cost
+ * indicates I/O or cache contention with foreground operations, so the limit is halved and then
+ * raised gradually once the read cost recovers.
  */
 class DataThrottle {
 public:
-    DataThrottle(OperationContext* opCtx)
-        : _startMillis(
-              opCtx->getServiceContext()->getFastClockSource()->now().toMillisSinceEpoch()),
-          _bytesProcessed(0),
-          _totalElapsedTimeSec(0),
-          _totalMBProcessed(0),
-          _shouldNotThrottle(false) {}
+    DataThrottle(OperationContext* opCtx);
 
     /**
      * If throttling is not enabled by calling turnThrottlingOff(), or if
@@ -125,13 +125,34 @@ public:
      *
      * In addition to throttling, while the thread is waiting, its operation context remains
      * interruptible.
+     *
+     * 'readTime' is the time spent fetching 'dataSize' bytes from storage, and is used to adapt
+     * the limit to foreground load when 'validateThrottleOnReadLatency' is enabled.
      */
-    void awaitIfNeeded(OperationContext* opCtx, const int64_t dataSize);
+    void awaitIfNeeded(OperationContext* opCtx,
+                       const int64_t dataSize,
+                       Microseconds readTime = Microseconds(0));
 
     void turnThrottlingOff() {
         _shouldNotThrottle = true;
     }
 
+    /**
+     * Returns whether the limit adapts to read latency, in which case callers should pass the time
+     * spent reading to awaitIfNeeded().
+     */
+    bool shouldMeasureReadTime() const {
+        return _measureReadTime;
+    }
+
+    /**
+     * Returns the limit in bytes per second imposed by read latency adaptation, or 0 if no such
+     * limit is currently in effect.
+     */
+    uint64_t getAdaptiveMaxBytesPerSec() const {
+        return _adaptiveMaxBytesPerSec;
+    }
+
 private:
     // Point-in-time (milliseconds) when tracking for the current second has started.
     int64_t _startMillis;
@@ -143,8 +164,28 @@ private:
     float _totalElapsedTimeSec;
     float _totalMBProcessed;
 
+    // Time spent reading from storage in the current second being tracked by '_startMillis'.
+    Microseconds _readTime;
+
+    // Moving average of the storage read time per MB processed, or 0 before the first sample.
+    double _averageReadMicrosPerMB = 0;
+
+    // Limit imposed by read latency adaptation, or 0 when there is none. '_backoffBytesPerSec' is
+    // the rate processed when the limit was first imposed; it is lifted once it recovers to it.
+    uint64_t _adaptiveMaxBytesPerSec = 0;
+    uint64_t _backoffBytesPerSec = 0;
+
+    // Cached value of 'validateThrottleOnReadLatency', refreshed at the start of every second.
+    bool _measureReadTime;
+
     // Whether the throttle should be active.
     bool _shouldNotThrottle;
+
+    /**
+     * Adjusts '_adaptiveMaxBytesPerSec' from the read time and bytes of the second that just
+     * ended.
+     */
+    void _adaptToReadLatency(uint64_t bytesProcessed, float elapsedTimeSec);
 };
 
 }  // namespace mongo
@@ -39,6 +39,7 @@
 #include "mongo/db/db_raii.h"
 #include "mongo/unittest/unittest.h"
 #include "mongo/util/clock_source_mock.h"
+#include "mongo/util/scopeguard.h"
 #include "mongo/util/time_support.h"
 
 namespace mongo {
@@ -379,6 +380,37 @@ TEST_F(ThrottleCursorTest, TestMixedCursorsWithSharedThrottleOn) {
     }
 }
 
+TEST_F(ThrottleCursorTest, TestDataThrottleAdaptsToReadLatency) {
+    auto opCtx = operationContext();
+
+    setMaxMbPerSec(0);
+    gValidateThrottleOnReadLatency.store(true);
+    ON_BLOCK_EXIT([] { gValidateThrottleOnReadLatency.store(false); });
+
+    // Every call advances the clock by 'kTickDelay', so a second is tracked every five calls.
+    const int64_t kOneMB = 1024 * 1024;
+    const Microseconds kFastRead{1000};
+    const Microseconds kSlowRead{10 * 1000};
+
+    // Establish the typical read cost. No limit is imposed while reads stay fast.
+    for (int i = 0; i < 15; i++) {
+        _dataThrottle->awaitIfNeeded(opCtx, kOneMB, kFastRead);
+    }
+    ASSERT_EQ(_dataThrottle->getAdaptiveMaxBytesPerSec(), 0U);
+
+    // Reads becoming an order of magnitude slower impose a limit.
+    for (int i = 0; i < 10 && _dataThrottle->getAdaptiveMaxBytesPerSec() == 0; i++) {
+        _dataThrottle->awaitIfNeeded(opCtx, kOneMB, kSlowRead);
+    }
+    ASSERT_GT(_dataThrottle->getAdaptiveMaxBytesPerSec(), 0U);
+
+    // The limit is lifted once reads are fast again.
+    for (int i = 0; i < 100 && _dataThrottle->getAdaptiveMaxBytesPerSec() != 0; i++) {
+        _dataThrottle->awaitIfNeeded(opCtx, kOneMB, kFastRead);
+    }
+    ASSERT_EQ(_dataThrottle->getAdaptiveMaxBytesPerSec(), 0U);
+}
+
 }  // namespace
 
 }  // namespace mongo
@@ -106,7 +106,7 @@ Status LogicalSessionCacheImpl::vivify(OperationContext* opCtx, const LogicalSes
 
 Status LogicalSessionCacheImpl::refreshNow(OperationContext* opCtx) {
     try {
-        _refresh(opCtx->getClient());
+        _refresh(opCtx->getClient(), false /* deferRecentlyPersisted */);
     } catch (...) {
         return exceptionToStatus();
     }
@@ -124,7 +124,7 @@ size_t LogicalSessionCacheImpl::size() {
 
 void LogicalSessionCacheImpl::_periodicRefresh(Client* client) {
     try {
-        _refresh(client);
+        _refresh(client, true /* deferRecentlyPersisted */);
     } catch (const DBException& ex) {
         LOGV2(
             20710,
@@ -221,7 +221,7 @@ Status LogicalSessionCacheImpl::_reap(Client* client) {
     return Status::OK();
 }
 
-void LogicalSessionCacheImpl::_refresh(Client* client) {
+void LogicalSessionCacheImpl::_refresh(Client* client, bool deferRecentlyPersisted) {
     // get or make an opCtx
     boost::optional<ServiceContext::UniqueOperationContext> uniqueCtx;
     auto* const opCtx = [&client, &uniqueCtx] {
@@ -245,6 +245,7 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
         // Clear the refresh-related stats with the beginning of our run.
         _stats.setLastSessionsCollectionJobDurationMillis(0);
         _stats.setLastSessionsCollectionJobEntriesRefreshed(0);
+        _stats.setLastSessionsCollectionJobEntriesDeferred(0);
         _stats.setLastSessionsCollectionJobEntriesEnded(0);
         _stats.setLastSessionsCollectionJobCursorsClosed(0);
 
@@ -307,25 +308,70 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
     // Refresh all recently active sessions as well as for sessions attached to running ops
     LogicalSessionRecordSet activeSessionRecords;
 
+    // Sessions which this node wrote recently enough for their record to be in no danger of
+    // expiring are not written again on this run. Recently active ones are put back into the cache
+    // instead, so that a later refresh writes them with a lastUse which is no earlier than their
+    // actual last use. Sessions attached to running ops are found again by the next refresh.
+    const auto now = _service->now();
+    const auto minPersistInterval = _getMinPersistInterval();
+    LogicalSessionIdMap<LogicalSessionRecord> deferredSessions;
+
     auto runningOpSessions = _service->getActiveOpSessions();
 
-    for (const auto& it : runningOpSessions) {
-        // if a running op is the cause of an upsert, we won't have a user name for the record
-        if (explicitlyEndingSessions.count(it) > 0) {
-            continue;
+    {
+        stdx::lock_guard<Latch> lk(_mutex);
+
+        const auto wasRecentlyPersisted = [&](const LogicalSessionId& lsid) {
+            if (!deferRecentlyPersisted || minPersistInterval <= Milliseconds(0)) {
+                return false;
+            }
+            auto it = _lastPersisted.find(lsid);
+            return it != _lastPersisted.end() && now - it->second < minPersistInterval;
+        };
+
+        for (const auto& it : runningOpSessions) {
+            // if a running op is the cause of an upsert, we won't have a user name for the record
+            if (explicitlyEndingSessions.count(it) > 0 || wasRecentlyPersisted(it)) {
+                continue;
+            }
+            activeSessionRecords.insert(makeLogicalSessionRecord(it, now));
+        }
+        for (const auto& it : activeSessions) {
+            if (wasRecentlyPersisted(it.first)) {
+                deferredSessions.emplace(it);
+                continue;
+            }
+            activeSessionRecords.insert(it.second);
         }
-        activeSessionRecords.insert(makeLogicalSessionRecord(it, _service->now()));
-    }
-    for (const auto& it : activeSessions) {
-        activeSessionRecords.insert(it.second);
     }
 
+    auto deferredSessionsBackSwapper = makeGuard([&] {
+        stdx::lock_guard<Latch> lk(_mutex);
+        for (const auto& it : deferredSessions) {
+            _activeSessions.emplace(it);
+        }
+    });
+
     // Refresh the active sessions in the sessions collection.
     _sessionsColl->refreshSessions(opCtx, activeSessionRecords);
     activeSessionsBackSwapper.dismiss();
     {
         stdx::lock_guard<Latch> lk(_mutex);
         _stats.setLastSessionsCollectionJobEntriesRefreshed(activeSessionRecords.size());
+        _stats.setLastSessionsCollectionJobEntriesDeferred(deferredSessions.size());
+
+        for (auto it = _lastPersisted.begin(); it != _lastPersisted.end();) {
+            if (now - it->second >= minPersistInterval) {
+                _lastPersisted.erase(it++);
+            } else {
+                ++it;
+            }
+        }
+        if (minPersistInterval > Milliseconds(0)) {
+            for (const auto& record : activeSessionRecords) {
+                _lastPersisted[record.getId()] = now;
+            }
+        }
     }
 
     // Remove the ending sessions from the sessions collection.
@@ -334,6 +380,10 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
     {
         stdx::lock_guard<Latch> lk(_mutex);
         _stats.setLastSessionsCollectionJobEntriesEnded(explicitlyEndingSessions.size());
+
+        for (const auto& lsid : explicitlyEndingSessions) {
+            _lastPersisted.erase(lsid);
+        }
     }
 
     // Find which running, but not recently active sessions, are expired, and add them
@@ -390,6 +440,13 @@ LogicalSessionCacheStats LogicalSessionCacheImpl::getStats() {
     return _stats;
 }
 
+Milliseconds LogicalSessionCacheImpl::_getMinPersistInterval() const {
+    // Never defer for longer than a fraction of the session timeout, so that the record of a
+    // session which is in use cannot expire before a later refresh writes it again.
+    const Milliseconds maxInterval = Minutes(localLogicalSessionTimeoutMinutes) / 4;
+    return std::min(Milliseconds(logicalSessionRefreshMinPersistIntervalMillis), maxInterval);
+}
+
 Status LogicalSessionCacheImpl::_addToCacheIfNotFull(WithLock, LogicalSessionRecord record) {
     if (_activeSessions.size() >= size_t(maxSessions)) {
         Status status = {ErrorCodes::TooManyLogicalSessions,
@@ -51,6 +51,12 @@ namespace mongo {
  *    every 5 minutes (300,000). If the caller is setting the sessionTimeout by hand, it is
  *    suggested that they consider also setting the refresh interval accordingly.
  *      --setParameter logicalSessionRefreshMillis=X.
+ *
+ *  - The minimum interval between two writes of the same session's record by the periodic refresh.
+ *    Sessions written more recently than this are carried over to a later refresh, which keeps
+ *    sessions in steady use from being rewritten on every run. Defaults to 10 minutes, capped at a
+ *    quarter of the session timeout.
+ *      --setParameter logicalSessionRefreshMinPersistIntervalMillis=X
  */
 class LogicalSessionCacheImpl final : public LogicalSessionCache {
 public:
@@ -91,7 +97,14 @@ public:
 
 private:
     void _periodicRefresh(Client* client);
-    void _refresh(Client* client);
+
+    /**
+     * Writes the recently active sessions to the sessions collection, removes the ended ones and
+     * kills the cursors of sessions which no longer exist. If 'deferRecentlyPersisted' is true,
+     * sessions which this node has written less than the minimum persist interval ago are kept in
+     * the cache for a later refresh instead of being written again.
+     */
+    void _refresh(Client* client, bool deferRecentlyPersisted);
 
     void _periodicReap(Client* client);
     Status _reap(Client* client);
@@ -103,6 +116,11 @@ private:
 
     Status _addToCacheIfNotFull(WithLock, LogicalSessionRecord record);
 
+    /**
+     * Returns the effective minimum interval between two refresh writes of the same session.
+     */
+    Milliseconds _getMinPersistInterval() const;
+
     const std::unique_ptr<ServiceLiaison> _service;
     const std::shared_ptr<SessionsCollection> _sessionsColl;
     const ReapSessionsOlderThanFn _reapSessionsOlderThanFn;
@@ -114,6 +132,10 @@ private:
 
     LogicalSessionIdSet _endingSessions;
 
+    // Time at which each session was last written to the sessions collection by a refresh. Entries
+    // older than the minimum persist interval are dropped on every refresh.
+    LogicalSessionIdMap<Date_t> _lastPersisted;
+
     Date_t _lastRefreshTime;
 
     LogicalSessionCacheStats _stats;
@@ -216,6 +216,51 @@ TEST_F(LogicalSessionCacheTest, ManySignedLsidsInCacheRefresh) {
     ASSERT_OK(cache()->refreshNow(opCtx()));
 }
 
+// Test that the periodic refresh does not rewrite sessions which it wrote recently, but keeps them
+// cached until a later refresh
+TEST_F(LogicalSessionCacheTest, PeriodicRefreshDefersRecentlyPersistedSessions) {
+    LogicalSessionIdSet refreshed;
+    sessions()->setRefreshHook([&refreshed](const LogicalSessionRecordSet& sessions) {
+        refreshed.clear();
+        for (const auto& record : sessions) {
+            refreshed.insert(record.getId());
+        }
+    });
+
+    const auto runPeriodicRefresh = [&] {
+        service()->runScheduledJob("LogicalSessionCacheRefresh", opCtx()->getClient());
+    };
+
+    // The first refresh writes the new session.
+    const auto lsid = makeLogicalSessionIdForTest();
+    ASSERT_OK(cache()->startSession(opCtx(), makeLogicalSessionRecord(lsid, service()->now())));
+    runPeriodicRefresh();
+    ASSERT(LogicalSessionIdSet{lsid} == refreshed);
+
+    // Using the session again shortly after does not get it written by the next periodic refresh,
+    // while a session which was never written does.
+    const auto newLsid = makeLogicalSessionIdForTest();
+    service()->fastForward(kForceRefresh);
+    ASSERT_OK(cache()->vivify(opCtx(), lsid));
+    ASSERT_OK(cache()->startSession(opCtx(), makeLogicalSessionRecord(newLsid, service()->now())));
+    runPeriodicRefresh();
+    ASSERT(LogicalSessionIdSet{newLsid} == refreshed);
+    ASSERT_EQ(1, cache()->getStats().getLastSessionsCollectionJobEntriesDeferred());
+    ASSERT(cache()->peekCached(lsid));
+
+    // An explicit refresh never defers.
+    ASSERT_OK(cache()->refreshNow(opCtx()));
+    ASSERT(LogicalSessionIdSet{lsid} == refreshed);
+    ASSERT_FALSE(cache()->peekCached(lsid));
+
+    // Once the minimum persist interval has elapsed, the session is written again.
+    ASSERT_OK(cache()->vivify(opCtx(), lsid));
+    service()->fastForward(kSessionTimeout / 4);
+    runPeriodicRefresh();
+    ASSERT(LogicalSessionIdSet{lsid} == refreshed);
+    ASSERT_EQ(0, cache()->getStats().getLastSessionsCollectionJobEntriesDeferred());
+}
+
 //
 TEST_F(LogicalSessionCacheTest, RefreshMatrixSessionState) {
     const std::vector<std::vector<std::string>> stateNames = {
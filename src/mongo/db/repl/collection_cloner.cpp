@@ -31,7 +31,10 @@
 
 #include "mongo/platform/basic.h"
 
+#include <algorithm>
+
 #include "mongo/base/string_data.h"
+#include "mongo/db/client.h"
 #include "mongo/db/commands/list_collections_filter.h"
 #include "mongo/db/index_build_entry_helpers.h"
 #include "mongo/db/index_builds_coordinator.h"
@@ -39,9 +42,12 @@
 #include "mongo/db/repl/collection_cloner.h"
 #include "mongo/db/repl/database_cloner_gen.h"
 #include "mongo/db/repl/repl_server_parameters_gen.h"
+#include "mongo/db/repl/replication_auth.h"
 #include "mongo/db/wire_version.h"
 #include "mongo/logv2/log.h"
+#include "mongo/rpc/get_status_from_command_result.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/thread_pool.h"
 
 namespace mongo {
 namespace repl {
@@ -54,6 +60,13 @@ MONGO_FAIL_POINT_DEFINE(initialSyncHangDuringCollectionClone);
 // DBClientConnection, optionally limited to a specific collection.
 MONGO_FAIL_POINT_DEFINE(initialSyncHangCollectionClonerAfterHandlingBatchResponse);
 
+namespace {
+
+// The number of _id values sampled for each partition when computing partition boundaries.
+const int kSamplesPerPartition = 10;
+
+}  // namespace
+
 CollectionCloner::CollectionCloner(const NamespaceString& sourceNss,
                                    const CollectionOptions& collectionOptions,
                                    InitialSyncSharedData* sharedData,
@@ -69,6 +82,7 @@ CollectionCloner::CollectionCloner(const NamespaceString& sourceNss,
       _countStage("count", this, &CollectionCloner::countStage),
       _listIndexesStage("listIndexes", this, &CollectionCloner::listIndexesStage),
       _createCollectionStage("createCollection", this, &CollectionCloner::createCollectionStage),
+      _partitionStage("partition", this, &CollectionCloner::partitionStage),
       _queryStage("query", this, &CollectionCloner::queryStage),
       _setupIndexBuildersForUnfinishedIndexesStage(
           "setupIndexBuildersForUnfinishedIndexes",
@@ -93,6 +107,14 @@ CollectionCloner::CollectionCloner(const NamespaceString& sourceNss,
           _dbWorkTaskRunner.schedule(std::move(task));
           return executor::TaskExecutor::CallbackHandle();
       }),
+      _createClientFn([this] {
+          auto client = std::make_unique<DBClientConnection>(true /* autoReconnect */);
+          uassertStatusOK(client->connect(getSource(), StringData()));
+          uassertStatusOK(replAuthenticate(client.get())
+                              .withContext(str::stream()
+                                           << "Failed to authenticate to " << getSource()));
+          return client;
+      }),
       _dbWorkTaskRunner(dbPool) {
     invariant(sourceNss.isValid());
     invariant(collectionOptions.uuid);
@@ -107,6 +129,7 @@ BaseCloner::ClonerStages CollectionCloner::getStages() {
     return {&_countStage,
             &_listIndexesStage,
             &_createCollectionStage,
+            &_partitionStage,
             &_queryStage,
             &_setupIndexBuildersForUnfinishedIndexesStage};
 }
@@ -214,8 +237,80 @@ BaseCloner::AfterStageBehavior CollectionCloner::createCollectionStage() {
     return kContinueNormally;
 }
 
+BaseCloner::AfterStageBehavior CollectionCloner::partitionStage() {
+    const int numPartitions = collectionClonerPartitions;
+    const auto documentsToCopy = getStats().documentToCopy;
+    _partitions.clear();
+
+    // Ranges are cloned in _id index order, so this requires an _id index compared with the
+    // simple collation. Capped collections must be inserted in their natural order.
+    if (numPartitions <= 1 ||
+        documentsToCopy < static_cast<size_t>(collectionClonerPartitionMinDocuments) ||
+        _idIndexSpec.isEmpty() || _collectionOptions.capped ||
+        !_collectionOptions.collation.isEmpty()) {
+        return kContinueNormally;
+    }
+
+    const int sampleSize = numPartitions * kSamplesPerPartition;
+    BSONObj result;
+    try {
+        getClient()->runCommand(
+            _sourceNss.db().toString(),
+            BSON("aggregate" << _sourceNss.coll() << "pipeline"
+                             << BSON_ARRAY(BSON("$sample" << BSON("size" << sampleSize))
+                                           << BSON("$project" << BSON("_id" << 1)))
+                             << "cursor" << BSON("batchSize" << sampleSize)),
+            result,
+            QueryOption_SlaveOk);
+    } catch (const DBException& e) {
+        result = BSON("ok" << 0 << "errmsg" << e.toString());
+    }
+
+    Status status = getStatusFromCommandResult(result);
+    if (status == ErrorCodes::NamespaceNotFound) {
+        uassertStatusOK(status);
+    }
+    if (!status.isOK() || !result["cursor"].isABSONObj()) {
+        LOGV2(4931000,
+              "Failed to sample _id values, cloning collection with a single query",
+              "namespace"_attr = _sourceNss,
+              "error"_attr = status);
+        return kContinueNormally;
+    }
+
+    std::vector<BSONObj> sampledIds;
+    for (auto&& elem : result["cursor"].Obj()["firstBatch"].Obj()) {
+        if (elem.isABSONObj() && elem.Obj().hasField("_id")) {
+            sampledIds.push_back(elem.Obj().getOwned());
+        }
+    }
+
+    const auto boundaries = computePartitionBoundaries(std::move(sampledIds), numPartitions);
+    if (boundaries.empty()) {
+        return kContinueNormally;
+    }
+
+    BSONObj min;
+    for (const auto& boundary : boundaries) {
+        _partitions.push_back({min, boundary});
+        min = boundary;
+    }
+    _partitions.push_back({min, BSONObj()});
+
+    LOGV2(4931001,
+          "Cloning collection in partitions",
+          "namespace"_attr = _sourceNss,
+          "numPartitions"_attr = _partitions.size(),
+          "documentsToCopy"_attr = documentsToCopy);
+    return kContinueNormally;
+}
+
 BaseCloner::AfterStageBehavior CollectionCloner::queryStage() {
-    runQuery();
+    if (_partitions.empty()) {
+        runQuery();
+    } else {
+        runPartitionedQuery();
+    }
     waitForDatabaseWorkToComplete();
     // We want to free the _collLoader regardless of whether the commit succeeds.
     std::unique_ptr<CollectionBulkLoader> loader = std::move(_collLoader);
@@ -350,18 +445,175 @@ void CollectionCloner::runQuery() {
     }
 }
 
-void CollectionCloner::handleNextBatch(DBClientCursorBatchIterator& iter) {
-    {
-        stdx::lock_guard<InitialSyncSharedData> lk(*getSharedData());
-        if (!getSharedData()->getInitialSyncStatus(lk).isOK()) {
-            static constexpr char message[] =
-                "Collection cloning cancelled due to initial sync failure";
-            LOGV2(21136, message, "error"_attr = getSharedData()->getInitialSyncStatus(lk));
-            uasserted(ErrorCodes::CallbackCanceled,
-                      str::stream()
-                          << message << ": " << getSharedData()->getInitialSyncStatus(lk));
+// static
+std::vector<BSONObj> CollectionCloner::computePartitionBoundaries(std::vector<BSONObj> sampledIds,
+                                                                  int numPartitions) {
+    auto idLessThan = [](const BSONObj& left, const BSONObj& right) {
+        return left.firstElement().woCompare(right.firstElement(), false) < 0;
+    };
+    auto idEqual = [](const BSONObj& left, const BSONObj& right) {
+        return left.firstElement().woCompare(right.firstElement(), false) == 0;
+    };
+    std::sort(sampledIds.begin(), sampledIds.end(), idLessThan);
+    sampledIds.erase(std::unique(sampledIds.begin(), sampledIds.end(), idEqual), sampledIds.end());
+
+    std::vector<BSONObj> boundaries;
+    if (numPartitions <= 1) {
+        return boundaries;
+    }
+
+    for (int i = 1; i < numPartitions; ++i) {
+        const size_t idx = sampledIds.size() * i / numPartitions;
+        if (idx == 0 || idx >= sampledIds.size()) {
+            continue;
+        }
+        const auto& boundary = sampledIds[idx];
+        if (boundaries.empty() || idLessThan(boundaries.back(), boundary)) {
+            boundaries.push_back(BSON("_id" << boundary.firstElement()));
+        }
+    }
+    return boundaries;
+}
+
+// static
+Query CollectionCloner::makePartitionQuery(const BSONObj& min, const BSONObj& max) {
+    // Index bounds, unlike query predicates, are not type-bracketed, so the ranges cover _id
+    // values of every type.
+    Query query;
+    query.hint(BSON("_id" << 1));
+    if (!min.isEmpty()) {
+        query.minKey(min);
+    }
+    if (!max.isEmpty()) {
+        query.maxKey(max);
+    }
+    return query;
+}
+
+void CollectionCloner::runPartitionedQuery() {
+    std::vector<Partition*> remaining;
+    for (auto& partition : _partitions) {
+        if (!partition.done) {
+            remaining.push_back(&partition);
+        }
+    }
+    if (remaining.empty()) {
+        return;
+    }
+
+    ThreadPool::Options options;
+    options.poolName = "CollectionClonerPartitionPool";
+    options.threadNamePrefix = "CollectionClonerPartition-";
+    options.minThreads = 0;
+    options.maxThreads = remaining.size();
+    options.onCreateThread = [](const std::string& threadName) {
+        Client::initThread(threadName);
+    };
+    ThreadPool pool(options);
+    pool.startup();
+
+    // Each task only writes its own status, which is read after the pool is joined.
+    std::vector<Status> statuses(remaining.size(), Status::OK());
+    for (size_t i = 0; i < remaining.size(); ++i) {
+        pool.schedule([this, partition = remaining[i], status = &statuses[i]](
+                          Status scheduleStatus) {
+            if (!scheduleStatus.isOK()) {
+                *status = scheduleStatus;
+                return;
+            }
+            try {
+                clonePartition(partition);
+            } catch (const DBException& e) {
+                *status = e.toStatus();
+            }
+        });
+    }
+    pool.shutdown();
+    pool.join();
+
+    // A dropped collection ends the clone cleanly, so report it ahead of any other error.
+    for (const auto& status : statuses) {
+        if (status == ErrorCodes::NamespaceNotFound) {
+            uassertStatusOK(status);
         }
     }
+    for (const auto& status : statuses) {
+        uassertStatusOK(status);
+    }
+}
+
+void CollectionCloner::clonePartition(Partition* partition) {
+    auto client = _createClientFn();
+
+    // A resumed query starts at the last document already queued, which must not be inserted
+    // twice.
+    bool skipLastId = !partition->lastId.isEmpty();
+    const BSONObj& min = skipLastId ? partition->lastId : partition->min;
+
+    client->query(
+        [&](DBClientCursorBatchIterator& iter) {
+            handleNextPartitionBatch(partition, &skipLastId, iter);
+        },
+        _sourceDbAndUuid,
+        makePartitionQuery(min, partition->max),
+        nullptr /* fieldsToReturn */,
+        QueryOption_NoCursorTimeout | QueryOption_SlaveOk |
+            (collectionClonerUsesExhaust ? QueryOption_Exhaust : 0),
+        _collectionClonerBatchSize,
+        ReadConcernArgs::kImplicitDefault);
+
+    partition->done = true;
+}
+
+void CollectionCloner::handleNextPartitionBatch(Partition* partition,
+                                                bool* skipLastId,
+                                                DBClientCursorBatchIterator& iter) {
+    throwIfInitialSyncFailed();
+
+    std::vector<BSONObj> docs;
+    while (iter.moreInCurrentBatch()) {
+        BSONObj doc = iter.nextSafe();
+        if (*skipLastId) {
+            *skipLastId = false;
+            if (doc["_id"].woCompare(partition->lastId.firstElement(), false) == 0) {
+                continue;
+            }
+        }
+        docs.emplace_back(std::move(doc));
+    }
+
+    if (docs.empty()) {
+        return;
+    }
+
+    {
+        stdx::lock_guard<Latch> lk(_mutex);
+        _stats.receivedBatches++;
+        std::move(docs.begin(), docs.end(), std::back_inserter(_documentsToInsert));
+        partition->lastId = BSON("_id" << _documentsToInsert.back()["_id"]);
+    }
+
+    auto&& scheduleResult = _scheduleDbWorkFn(
+        [=](const executor::TaskExecutor::CallbackArgs& cbd) { insertDocumentsCallback(cbd); });
+    if (!scheduleResult.isOK()) {
+        uassertStatusOK(scheduleResult.getStatus().withContext(
+            str::stream() << "Error cloning collection '" << _sourceNss.ns() << "'"));
+    }
+}
+
+void CollectionCloner::throwIfInitialSyncFailed() {
+    stdx::lock_guard<InitialSyncSharedData> lk(*getSharedData());
+    if (!getSharedData()->getInitialSyncStatus(lk).isOK()) {
+        static constexpr char message[] =
+            "Collection cloning cancelled due to initial sync failure";
+        LOGV2(21136, message, "error"_attr = getSharedData()->getInitialSyncStatus(lk));
+        uasserted(ErrorCodes::CallbackCanceled,
+                  str::stream() << message << ": " << getSharedData()->getInitialSyncStatus(lk));
+    }
+}
+
+void CollectionCloner::handleNextBatch(DBClientCursorBatchIterator& iter) {
+    throwIfInitialSyncFailed();
 
     // If this is 'true', it means that something happened to our remote cursor for a reason other
     // than the collection being dropped, all while we were running a non-resumable (4.2) clone.
@@ -425,9 +677,9 @@ void CollectionCloner::handleNextBatch(DBClientCursorBatchIterator& iter) {
 void CollectionCloner::insertDocumentsCallback(const executor::TaskExecutor::CallbackArgs& cbd) {
     uassertStatusOK(cbd.status);
 
+    std::vector<BSONObj> docs;
     {
         stdx::lock_guard<Latch> lk(_mutex);
-        std::vector<BSONObj> docs;
         if (_documentsToInsert.size() == 0) {
             LOGV2_WARNING(21145,
                           "insertDocumentsCallback, but no documents to insert for ns:{namespace}",
@@ -440,12 +692,13 @@ void CollectionCloner::insertDocumentsCallback(const executor::TaskExecutor::Cal
         ++_stats.fetchedBatches;
         _progressMeter.hit(int(docs.size()));
         invariant(_collLoader);
-
-        // The insert must be done within the lock, because CollectionBulkLoader is not
-        // thread safe.
-        uassertStatusOK(_collLoader->insertDocuments(docs.cbegin(), docs.cend()));
     }
 
+    // CollectionBulkLoader is not thread safe, but it is only used by the database work task
+    // runner, which runs one task at a time. Inserting outside of the lock lets concurrent
+    // partition queries keep queueing documents in the meantime.
+    uassertStatusOK(_collLoader->insertDocuments(docs.cbegin(), docs.cend()));
+
     initialSyncHangDuringCollectionClone.executeIf(
         [&](const BSONObj&) {
             LOGV2(21138,
@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -72,6 +73,13 @@ public:
     using ScheduleDbWorkFn = unique_function<StatusWith<executor::TaskExecutor::CallbackHandle>(
         executor::TaskExecutor::CallbackFn)>;
 
+    /**
+     * Type of function to create the additional connections to the sync source used to clone the
+     * partitions of a large collection concurrently. The returned client must be connected and
+     * authenticated.
+     */
+    using CreateClientFn = std::function<std::unique_ptr<DBClientConnection>()>;
+
     CollectionCloner(const NamespaceString& ns,
                      const CollectionOptions& collectionOptions,
                      InitialSyncSharedData* sharedData,
@@ -117,6 +125,30 @@ public:
         _scheduleDbWorkFn = std::move(scheduleDbWorkFn);
     }
 
+    /**
+     * Overrides how connections for partitioned cloning are created.
+     *
+     * For testing only.
+     */
+    void setCreateClientFn_forTest(CreateClientFn createClientFn) {
+        _createClientFn = std::move(createClientFn);
+    }
+
+    /**
+     * Given 'sampledIds', a random sample of documents of the form {_id: <value>}, returns up to
+     * 'numPartitions' - 1 distinct boundaries in ascending _id order that split the collection into
+     * ranges of roughly equal size. The first range is unbounded below and the last range is
+     * unbounded above.
+     */
+    static std::vector<BSONObj> computePartitionBoundaries(std::vector<BSONObj> sampledIds,
+                                                           int numPartitions);
+
+    /**
+     * Returns the query used to clone the _id range ['min', 'max'). An empty bound means the range
+     * is unbounded on that side.
+     */
+    static Query makePartitionQuery(const BSONObj& min, const BSONObj& max);
+
 protected:
     ClonerStages getStages() final;
 
@@ -125,6 +157,22 @@ protected:
 private:
     friend class CollectionClonerTest;
 
+    /**
+     * A range of _id values cloned by its own query when a collection is cloned in partitions.
+     */
+    struct Partition {
+        // Inclusive lower and exclusive upper bounds of the form {_id: <value>}, or empty if the
+        // range is unbounded on that side.
+        BSONObj min;
+        BSONObj max;
+
+        // The _id, as {_id: <value>}, of the last document of this range queued for insertion.
+        // A retried query resumes from here.
+        BSONObj lastId;
+
+        bool done = false;
+    };
+
     class CollectionClonerStage : public ClonerStage<CollectionCloner> {
     public:
         CollectionClonerStage(std::string name, CollectionCloner* cloner, ClonerRunFn stageFunc)
@@ -189,10 +237,20 @@ private:
      */
     AfterStageBehavior createCollectionStage();
 
+    /**
+     * Stage function that decides whether a large collection is cloned as several _id ranges
+     * concurrently, and computes the range boundaries by sampling _id values on the source. Falls
+     * back to cloning with a single query if sampling fails.
+     */
+    AfterStageBehavior partitionStage();
+
     /**
      * Stage function that executes a query to retrieve all documents in the collection.  For each
      * batch returned by the upstream node, handleNextBatch will be called with the data.  This
      * stage will finish when the entire query is finished or failed.
+     *
+     * If partitionStage split the collection, each remaining partition is queried concurrently
+     * instead.
      */
     AfterStageBehavior queryStage();
 
@@ -207,6 +265,19 @@ private:
      */
     void handleNextBatch(DBClientCursorBatchIterator& iter);
 
+    /**
+     * Queues the documents of a batch of a partition query for insertion, and records the last _id
+     * seen so the partition can be resumed.
+     */
+    void handleNextPartitionBatch(Partition* partition,
+                                  bool* skipLastId,
+                                  DBClientCursorBatchIterator& iter);
+
+    /**
+     * Throws if initial sync has failed, to terminate the running query.
+     */
+    void throwIfInitialSyncFailed();
+
     /**
      * Called whenever there is a new batch of documents ready from the DBClientConnection.
      *
@@ -221,6 +292,17 @@ private:
      */
     void runQuery();
 
+    /**
+     * Clones every partition that is not yet done concurrently, each over its own connection.
+     * Throws the first error encountered once all the partition queries have stopped.
+     */
+    void runPartitionedQuery();
+
+    /**
+     * Queries the source for the documents in 'partition', resuming after its last queued _id.
+     */
+    void clonePartition(Partition* partition);
+
     /**
      * Used to terminate the clone when we encounter a fatal error during a non-resumable query.
      * Throws.
@@ -244,6 +326,7 @@ private:
     CollectionClonerStage _countStage;                                   // (R)
     CollectionClonerStage _listIndexesStage;                             // (R)
     CollectionClonerStage _createCollectionStage;                        // (R)
+    CollectionClonerStage _partitionStage;                               // (R)
     CollectionClonerQueryStage _queryStage;                              // (R)
     CollectionClonerStage _setupIndexBuildersForUnfinishedIndexesStage;  // (R)
 
@@ -254,6 +337,11 @@ private:
     std::unique_ptr<CollectionBulkLoader> _collLoader;  // (X)
     //  Function for scheduling database work using the executor.
     ScheduleDbWorkFn _scheduleDbWorkFn;  // (R)
+    // Function for creating connections used to clone partitions.
+    CreateClientFn _createClientFn;  // (R)
+    // The _id ranges cloned concurrently, or empty if the collection is cloned by a single query.
+    // Each partition is only accessed by the thread cloning it while the query stage runs.
+    std::vector<Partition> _partitions;  // (X)
     // Documents read from source to insert.
     std::vector<BSONObj> _documentsToInsert;  // (M)
     Stats _stats;                             // (M)
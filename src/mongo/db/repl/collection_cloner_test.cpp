@@ -34,6 +34,7 @@
 #include "mongo/bson/bsonmisc.h"
 #include "mongo/db/repl/cloner_test_fixture.h"
 #include "mongo/db/repl/collection_cloner.h"
+#include "mongo/db/repl/repl_server_parameters_gen.h"
 #include "mongo/db/repl/storage_interface.h"
 #include "mongo/db/repl/storage_interface_mock.h"
 #include "mongo/db/service_context_test_fixture.h"
@@ -1148,5 +1149,196 @@ TEST_F(CollectionClonerTestNonResumable, NonResumableCursorErrorThenSuccessEqual
     clonerThread.join();
 }
 
+TEST(CollectionClonerPartitionTest, PartitionBoundariesSplitSampleEvenly) {
+    std::vector<BSONObj> sampledIds;
+    for (int i = 7; i >= 0; --i) {
+        sampledIds.push_back(BSON("_id" << i));
+    }
+    auto boundaries = CollectionCloner::computePartitionBoundaries(sampledIds, 4);
+    ASSERT_EQ(3U, boundaries.size());
+    ASSERT_BSONOBJ_EQ(BSON("_id" << 2), boundaries[0]);
+    ASSERT_BSONOBJ_EQ(BSON("_id" << 4), boundaries[1]);
+    ASSERT_BSONOBJ_EQ(BSON("_id" << 6), boundaries[2]);
+}
+
+TEST(CollectionClonerPartitionTest, PartitionBoundariesIgnoreDuplicateSamples) {
+    std::vector<BSONObj> sampledIds{BSON("_id" << 1),
+                                    BSON("_id" << 1),
+                                    BSON("_id" << 1),
+                                    BSON("_id" << 2),
+                                    BSON("_id" << 2),
+                                    BSON("_id" << 3)};
+    auto boundaries = CollectionCloner::computePartitionBoundaries(sampledIds, 3);
+    ASSERT_EQ(2U, boundaries.size());
+    ASSERT_BSONOBJ_EQ(BSON("_id" << 2), boundaries[0]);
+    ASSERT_BSONOBJ_EQ(BSON("_id" << 3), boundaries[1]);
+}
+
+TEST(CollectionClonerPartitionTest, PartitionBoundariesWithFewSamples) {
+    ASSERT(CollectionCloner::computePartitionBoundaries({}, 4).empty());
+    ASSERT(CollectionCloner::computePartitionBoundaries({BSON("_id" << 1)}, 4).empty());
+
+    auto boundaries =
+        CollectionCloner::computePartitionBoundaries({BSON("_id" << 1), BSON("_id" << 2)}, 8);
+    ASSERT_EQ(1U, boundaries.size());
+    ASSERT_BSONOBJ_EQ(BSON("_id" << 2), boundaries[0]);
+}
+
+TEST(CollectionClonerPartitionTest, PartitionBoundariesOrderMixedTypes) {
+    std::vector<BSONObj> sampledIds{
+        BSON("_id"
+             << "b"),
+        BSON("_id" << 5),
+        BSON("_id"
+             << "a"),
+        BSON("_id" << 1)};
+    auto boundaries = CollectionCloner::computePartitionBoundaries(sampledIds, 2);
+    ASSERT_EQ(1U, boundaries.size());
+    ASSERT_BSONOBJ_EQ(BSON("_id"
+                           << "a"),
+                      boundaries[0]);
+}
+
+TEST(CollectionClonerPartitionTest, PartitionQueryUsesIdIndexBounds) {
+    auto query = CollectionCloner::makePartitionQuery(BSON("_id" << 1), BSON("_id" << 5));
+    ASSERT_BSONOBJ_EQ(BSON("_id" << 1), query.obj["$min"].Obj());
+    ASSERT_BSONOBJ_EQ(BSON("_id" << 5), query.obj["$max"].Obj());
+    ASSERT_BSONOBJ_EQ(BSON("_id" << 1), query.getHint());
+
+    auto unbounded = CollectionCloner::makePartitionQuery(BSONObj(), BSONObj());
+    ASSERT_FALSE(unbounded.obj.hasField("$min"));
+    ASSERT_FALSE(unbounded.obj.hasField("$max"));
+    ASSERT_BSONOBJ_EQ(BSON("_id" << 1), unbounded.getHint());
+}
+
+/**
+ * A connection which fails the query of the partition bounded above once, after the first batch of
+ * that query has been handled.
+ */
+class FailAfterFirstBatchClient : public MockDBClientConnection {
+public:
+    FailAfterFirstBatchClient(MockRemoteDBServer* remoteServer, AtomicWord<bool>* failed)
+        : MockDBClientConnection(remoteServer, true /* autoReconnect */), _failed(failed) {}
+
+    using MockDBClientConnection::query;
+
+    unsigned long long query(std::function<void(DBClientCursorBatchIterator&)> f,
+                             const NamespaceStringOrUUID& nsOrUuid,
+                             Query query,
+                             const BSONObj* fieldsToReturn,
+                             int queryOptions,
+                             int batchSize,
+                             boost::optional<BSONObj> readConcernObj) override {
+        const bool failQuery = query.obj.hasField("$max") && !_failed->swap(true);
+        return MockDBClientConnection::query(
+            [&](DBClientCursorBatchIterator& iter) {
+                f(iter);
+                uassert(ErrorCodes::HostUnreachable, "Partition query failed for test", !failQuery);
+            },
+            nsOrUuid,
+            query,
+            fieldsToReturn,
+            queryOptions,
+            batchSize,
+            readConcernObj);
+    }
+
+private:
+    AtomicWord<bool>* const _failed;
+};
+
+class CollectionClonerTestPartitioned : public CollectionClonerTest {
+protected:
+    void setUp() final {
+        CollectionClonerTest::setUp();
+        setInitialSyncId();
+
+        _savedPartitions = collectionClonerPartitions;
+        _savedPartitionMinDocuments = collectionClonerPartitionMinDocuments;
+        collectionClonerPartitions = 2;
+        collectionClonerPartitionMinDocuments = 1;
+
+        _mockServer->setCommandReply("count", createCountResponse(8));
+        _mockServer->setCommandReply("listIndexes",
+                                     createCursorResponse(_nss.ns(), BSON_ARRAY(_idIndexSpec)));
+
+        // Every _id is sampled, so the collection is split at {_id: 5}.
+        BSONArrayBuilder sampledIds;
+        for (int i = 1; i <= 8; ++i) {
+            _mockServer->insert(_nss.ns(), BSON("_id" << i));
+            sampledIds.append(BSON("_id" << i));
+        }
+        _mockServer->setCommandReply("aggregate",
+                                     createCursorResponse(_nss.ns(), sampledIds.arr()));
+    }
+
+    void tearDown() final {
+        collectionClonerPartitions = _savedPartitions;
+        collectionClonerPartitionMinDocuments = _savedPartitionMinDocuments;
+        CollectionClonerTest::tearDown();
+    }
+
+    std::unique_ptr<CollectionCloner> makePartitionedCloner(bool failFirstPartitionQuery = false) {
+        auto cloner = makeCollectionCloner();
+        cloner->setBatchSize_forTest(2);
+        cloner->setCreateClientFn_forTest([this, failFirstPartitionQuery] {
+            _clientsCreated.fetchAndAdd(1);
+            std::unique_ptr<DBClientConnection> client;
+            if (failFirstPartitionQuery) {
+                client = std::make_unique<FailAfterFirstBatchClient>(_mockServer.get(),
+                                                                     &_failedPartitionQuery);
+            } else {
+                client = std::make_unique<MockDBClientConnection>(_mockServer.get(), true);
+            }
+            return client;
+        });
+        return cloner;
+    }
+
+    AtomicWord<int> _clientsCreated{0};
+    AtomicWord<bool> _failedPartitionQuery{false};
+
+private:
+    int _savedPartitions;
+    long long _savedPartitionMinDocuments;
+};
+
+TEST_F(CollectionClonerTestPartitioned, PartitionedClone) {
+    auto cloner = makePartitionedCloner();
+    ASSERT_OK(cloner->run());
+
+    ASSERT_EQ(2, _clientsCreated.load());
+    ASSERT_EQUALS(8, _collectionStats->insertCount);
+    ASSERT_TRUE(_collectionStats->commitCalled);
+    auto stats = cloner->getStats();
+    ASSERT_EQUALS(8u, stats.documentsCopied);
+    ASSERT_EQUALS(4u, stats.receivedBatches);
+}
+
+TEST_F(CollectionClonerTestPartitioned, PartitionedCloneResumesFailedPartition) {
+    auto cloner = makePartitionedCloner(true /* failFirstPartitionQuery */);
+    ASSERT_OK(cloner->run());
+
+    // Only the failed partition is queried again, and it resumes after the documents of its first
+    // batch rather than inserting them twice.
+    ASSERT_TRUE(_failedPartitionQuery.load());
+    ASSERT_EQ(3, _clientsCreated.load());
+    ASSERT_EQUALS(8, _collectionStats->insertCount);
+    ASSERT_TRUE(_collectionStats->commitCalled);
+    ASSERT_EQUALS(8u, cloner->getStats().documentsCopied);
+}
+
+TEST_F(CollectionClonerTestPartitioned, SampleFailureFallsBackToSingleQuery) {
+    _mockServer->setCommandReply("aggregate", Status(ErrorCodes::OperationFailed, ""));
+
+    auto cloner = makePartitionedCloner();
+    ASSERT_OK(cloner->run());
+
+    ASSERT_EQ(0, _clientsCreated.load());
+    ASSERT_EQUALS(8, _collectionStats->insertCount);
+    ASSERT_TRUE(_collectionStats->commitCalled);
+    ASSERT_EQUALS(8u, cloner->getStats().documentsCopied);
+}
+
 }  // namespace repl
 }  // namespace mongo
@@ -33,11 +33,9 @@
 
 #include "mongo/db/repl/insert_group.h"
 
-#include <algorithm>
 #include <iterator>
 
 #include "mongo/bson/bsonobjbuilder.h"
-#include "mongo/db/ops/write_ops.h"
 #include "mongo/db/repl/oplog_applier_impl.h"
 #include "mongo/db/repl/oplog_entry.h"
 #include "mongo/logv2/log.h"
@@ -46,20 +44,10 @@
 namespace mongo {
 namespace repl {
 
-namespace {
-
-// Must not create too large an object.
-const auto kInsertGroupMaxGroupSize = write_ops::insertVectorMaxBytes;
-
-// Limit number of ops in a single group.
-constexpr auto kInsertGroupMaxOpCount = 64;
-
-}  // namespace
-
 InsertGroup::InsertGroup(std::vector<const OplogEntry*>* ops,
                          OperationContext* opCtx,
                          InsertGroup::Mode mode)
-    : _doNotGroupBeforePoint(ops->cbegin()), _end(ops->cend()), _opCtx(opCtx), _mode(mode) {}
+    : _groupFinder(ops), _opCtx(opCtx), _mode(mode) {}
 
 StatusWith<InsertGroup::ConstIterator> InsertGroup::groupAndApplyInserts(ConstIterator it) {
     const auto& entry = **it;
@@ -76,44 +64,15 @@ StatusWith<InsertGroup::ConstIterator> InsertGroup::groupAndApplyInserts(ConstIt
         return Status(ErrorCodes::InvalidOptions,
                       "Cannot group insert operations on capped collections.");
     }
-    if (it <= _doNotGroupBeforePoint) {
+    if (_groupFinder.previouslyAttempted(it)) {
         return Status(ErrorCodes::InvalidPath,
                       "Cannot group an insert operation that we previously attempted to group.");
     }
 
-    // Attempt to group 'insert' ops if possible.
-    std::vector<BSONObj> toInsert;
-
-    // Make sure to include the first op in the group size.
-    size_t groupSize = entry.getObject().objsize();
-    auto opCount = std::vector<const OplogEntry*>::size_type(1);
-    auto groupNamespace = entry.getNss();
-
-    /**
-     * Search for the op that delimits this insert group, and save its position
-     * in endOfGroupableOpsIterator. For example, given the following list of oplog
-     * entries with a sequence of groupable inserts:
-     *
-     *                S--------------E
-     *       u, u, u, i, i, i, i, i, d, d
-     *
-     *       S: start of insert group
-     *       E: end of groupable ops
-     *
-     * E is the position of endOfGroupableOpsIterator. i.e. endOfGroupableOpsIterator
-     * will point to the first op that *can't* be added to the current insert group.
-     */
+    // Search for the first op that *can't* be added to the current insert group.
     auto endOfGroupableOpsIterator =
-        std::find_if(it + 1, _end, [&](const OplogEntry* nextEntry) -> bool {
-            auto opNamespace = nextEntry->getNss();
-            groupSize += nextEntry->getObject().objsize();
-            opCount += 1;
-
-            // Only add the op to this group if it passes the criteria.
-            return nextEntry->getOpType() != OpTypeEnum::kInsert  // Must be an insert.
-                || opNamespace != groupNamespace                  // Must be in the same namespace.
-                || groupSize > kInsertGroupMaxGroupSize  // Must not create too large an object.
-                || opCount > kInsertGroupMaxOpCount;     // Limit number of ops in a single group.
+        _groupFinder.findEndOfGroup(it, [](const OplogEntry& nextEntry) {
+            return nextEntry.getOpType() == OpTypeEnum::kInsert;  // Must be an insert.
         });
 
     // See if we were able to create a group that contains more than a single op.
@@ -153,9 +112,7 @@ StatusWith<InsertGroup::ConstIterator> InsertGroup::groupAndApplyInserts(ConstIt
                         "firstInsert"_attr = redact(entry.getRaw()));
         }
 
-        // Avoid quadratic run time from failed insert by not retrying until we
-        // are beyond this group of ops.
-        _doNotGroupBeforePoint = endOfGroupableOpsIterator - 1;
+        _groupFinder.markFailedGroup(endOfGroupableOpsIterator);
 
         return status;
     }
@@ -33,6 +33,7 @@
 #include "mongo/base/status_with.h"
 #include "mongo/db/repl/multiapplier.h"
 #include "mongo/db/repl/oplog_applier.h"
+#include "mongo/db/repl/oplog_entry_group_finder.h"
 
 namespace mongo {
 namespace repl {
@@ -61,12 +62,8 @@ public:
     StatusWith<ConstIterator> groupAndApplyInserts(ConstIterator oplogEntriesIterator);
 
 private:
-    // _doNotGroupBeforePoint is used to prevent retrying bad group inserts by marking the final op
-    // of a failed group and not allowing further group inserts until that op has been processed.
-    ConstIterator _doNotGroupBeforePoint;
-
-    // Used for constructing search bounds when grouping inserts.
-    ConstIterator _end;
+    // Finds groupable inserts and remembers groups that failed to apply.
+    OplogEntryGroupFinder _groupFinder;
 
     // Passed to applyOplogEntryOrGroupedInserts when applying grouped inserts.
     OperationContext* _opCtx;
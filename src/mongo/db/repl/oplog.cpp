@@ -915,7 +915,8 @@ Status applyOperation_inlock(OperationContext* opCtx,
                              const OplogEntryOrGroupedInserts& opOrGroupedInserts,
                              bool alwaysUpsert,
                              OplogApplication::Mode mode,
-                             IncrementOpsAppliedStatsFn incrementOpsAppliedStats) {
+                             IncrementOpsAppliedStatsFn incrementOpsAppliedStats,
+                             bool isGroupedUpdateOrDelete) {
     // Get the single oplog entry to be applied or the first oplog entry of grouped inserts.
     auto op = opOrGroupedInserts.getOp();
     LOGV2_DEBUG(21254,
@@ -933,6 +934,17 @@ Status applyOperation_inlock(OperationContext* opCtx,
         mode == repl::OplogApplication::Mode::kApplyOpsCmd || opCtx->writesAreReplicated();
     OpCounters* opCounters = shouldUseGlobalOpCounters ? &globalOpCounters : &replOpCounters;
 
+    // An update or delete applied as part of a group is only counted and reported once the group
+    // commits, since a group which fails is applied again one operation at a time.
+    auto reportApplied = [opCtx, isGroupedUpdateOrDelete](std::function<void()> report) {
+        if (isGroupedUpdateOrDelete) {
+            opCtx->recoveryUnit()->onCommit(
+                [report = std::move(report)](boost::optional<Timestamp>) { report(); });
+        } else {
+            report();
+        }
+    };
+
     auto opType = op.getOpType();
     if (opType == OpTypeEnum::kNoop) {
         // no op
@@ -1198,7 +1210,7 @@ Status applyOperation_inlock(OperationContext* opCtx,
             break;
         }
         case OpTypeEnum::kUpdate: {
-            opCounters->gotUpdate();
+            reportApplied([opCounters] { opCounters->gotUpdate(); });
             if (shouldUseGlobalOpCounters) {
                 ServerWriteConcernMetrics::get(opCtx)->recordWriteConcernForUpdate(
                     opCtx->getWriteConcern());
@@ -1291,10 +1303,12 @@ Status applyOperation_inlock(OperationContext* opCtx,
                            !ur.upserted.isEmpty() && !(collection && collection->isCapped())) {
                     // This indicates we upconverted an update to an upsert, and it did indeed
                     // upsert.  In steady state mode this is unexpected.
-                    LOGV2_WARNING(2170001,
-                                  "update needed to be converted to upsert",
-                                  "op"_attr = redact(op.toBSON()));
-                    opCounters->gotUpdateOnMissingDoc();
+                    reportApplied([opCounters, opObj = op.toBSON().getOwned()] {
+                        LOGV2_WARNING(2170001,
+                                      "update needed to be converted to upsert",
+                                      "op"_attr = redact(opObj));
+                        opCounters->gotUpdateOnMissingDoc();
+                    });
 
                     // We shouldn't be doing upserts in secondary mode when enforcing steady state
                     // constraints.
@@ -1315,7 +1329,7 @@ Status applyOperation_inlock(OperationContext* opCtx,
             break;
         }
         case OpTypeEnum::kDelete: {
-            opCounters->gotDelete();
+            reportApplied([opCounters] { opCounters->gotDelete(); });
             if (shouldUseGlobalOpCounters) {
                 ServerWriteConcernMetrics::get(opCtx)->recordWriteConcernForDelete(
                     opCtx->getWriteConcern());
@@ -1346,14 +1360,17 @@ Status applyOperation_inlock(OperationContext* opCtx,
                 auto nDeleted = deleteObjects(
                     opCtx, collection, requestNss, deleteCriteria, true /* justOne */);
                 if (nDeleted == 0 && mode == OplogApplication::Mode::kSecondary) {
-                    LOGV2_WARNING(2170002,
-                                  "Applied a delete which did not delete anything in steady state "
-                                  "replication",
-                                  "op"_attr = redact(op.toBSON()));
-                    if (collection)
-                        opCounters->gotDeleteWasEmpty();
-                    else
-                        opCounters->gotDeleteFromMissingNamespace();
+                    const bool haveCollection = collection != nullptr;
+                    reportApplied([opCounters, haveCollection, opObj = op.toBSON().getOwned()] {
+                        LOGV2_WARNING(2170002,
+                                      "Applied a delete which did not delete anything in steady "
+                                      "state replication",
+                                      "op"_attr = redact(opObj));
+                        if (haveCollection)
+                            opCounters->gotDeleteWasEmpty();
+                        else
+                            opCounters->gotDeleteFromMissingNamespace();
+                    });
                     // This error is fatal when we are enforcing steady state constraints.
                     uassert(collection ? ErrorCodes::NoSuchKey : ErrorCodes::NamespaceNotFound,
                             str::stream() << "Applied a delete which did not delete anything in "
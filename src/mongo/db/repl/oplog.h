@@ -198,6 +198,8 @@ inline std::ostream& operator<<(std::ostream& s, OplogApplication::Mode mode) {
  * @param alwaysUpsert convert some updates to upserts for idempotency reasons
  * @param mode specifies what oplog application mode we are in
  * @param incrementOpsAppliedStats is called whenever an op is applied.
+ * @param isGroupedUpdateOrDelete the op is an update or delete applied as part of a group in the
+ * caller's WriteUnitOfWork, so it is only counted and reported once that commits.
  * Returns failure status if the op was an update that could not be applied.
  */
 Status applyOperation_inlock(OperationContext* opCtx,
@@ -205,7 +207,8 @@ Status applyOperation_inlock(OperationContext* opCtx,
                              const OplogEntryOrGroupedInserts& opOrGroupedInserts,
                              bool alwaysUpsert,
                              OplogApplication::Mode mode,
-                             IncrementOpsAppliedStatsFn incrementOpsAppliedStats = {});
+                             IncrementOpsAppliedStatsFn incrementOpsAppliedStats = {},
+                             bool isGroupedUpdateOrDelete = false);
 
 /**
  * Take a command op and apply it locally
@@ -45,6 +45,7 @@
 #include "mongo/db/repl/insert_group.h"
 #include "mongo/db/repl/repl_server_parameters_gen.h"
 #include "mongo/db/repl/transaction_oplog_application.h"
+#include "mongo/db/repl/update_delete_group.h"
 #include "mongo/db/stats/counters.h"
 #include "mongo/db/stats/timer_stats.h"
 #include "mongo/db/storage/control/storage_control.h"
@@ -98,13 +99,15 @@ NamespaceStringOrUUID getNsOrUUID(const NamespaceString& nss, const OplogEntry&
 
 /**
  * Used for logging a report of ops that take longer than "slowMS" to apply. This is called
- * right before returning from applyOplogEntryOrGroupedInserts, and it returns the same status.
+ * right before returning from applyOplogEntryOrGroupedInserts and applyGroupedUpdatesAndDeletes,
+ * and it returns the same status. 'describeOps' is only called if the report is logged.
  */
 Status finishAndLogApply(OperationContext* opCtx,
                          ClockSource* clockSource,
                          Status finalStatus,
                          Date_t applyStartTime,
-                         const OplogEntryOrGroupedInserts& entryOrGroupedInserts) {
+                         OpTypeEnum opType,
+                         const std::function<BSONObj()>& describeOps) {
 
     if (finalStatus.isOK()) {
         auto applyEndTime = clockSource->now();
@@ -118,8 +121,8 @@ Status finishAndLogApply(OperationContext* opCtx,
 
             logv2::DynamicAttributes attrs;
 
-            auto redacted = redact(entryOrGroupedInserts.toBSON());
-            if (entryOrGroupedInserts.getOp().getOpType() == OpTypeEnum::kCommand) {
+            auto redacted = redact(describeOps());
+            if (opType == OpTypeEnum::kCommand) {
                 attrs.add("command", redacted);
             } else {
                 attrs.add("CRUD", redacted);
@@ -133,6 +136,19 @@ Status finishAndLogApply(OperationContext* opCtx,
     return finalStatus;
 }
 
+Status finishAndLogApply(OperationContext* opCtx,
+                         ClockSource* clockSource,
+                         Status finalStatus,
+                         Date_t applyStartTime,
+                         const OplogEntryOrGroupedInserts& entryOrGroupedInserts) {
+    return finishAndLogApply(opCtx,
+                             clockSource,
+                             std::move(finalStatus),
+                             applyStartTime,
+                             entryOrGroupedInserts.getOp().getOpType(),
+                             [&] { return entryOrGroupedInserts.toBSON(); });
+}
+
 /**
  * Caches per-collection properties which are relevant for oplog application, so that they don't
  * have to be retrieved repeatedly for each op.
@@ -1021,6 +1037,97 @@ Status applyOplogEntryOrGroupedInserts(OperationContext* opCtx,
     MONGO_UNREACHABLE;
 }
 
+Status applyGroupedUpdatesAndDeletes(OperationContext* opCtx,
+                                     std::vector<const OplogEntry*>::const_iterator begin,
+                                     std::vector<const OplogEntry*>::const_iterator end,
+                                     OplogApplication::Mode oplogApplicationMode) {
+    // Guarantees that applyGroupedUpdatesAndDeletes' context matches that of its calling
+    // function, applyOplogBatchPerWorker.
+    invariant(!opCtx->writesAreReplicated());
+    invariant(documentValidationDisabled(opCtx));
+    invariant(std::distance(begin, end) > 1);
+
+    const auto& firstOp = **begin;
+    const NamespaceString nss(firstOp.getNss());
+
+    // Report the whole group as a single operation.
+    CurOp groupOp(opCtx);
+
+    auto clockSource = opCtx->getServiceContext()->getFastClockSource();
+    auto applyStartTime = clockSource->now();
+
+    if (MONGO_unlikely(hangAfterRecordingOpApplicationStartTime.shouldFail())) {
+        LOGV2(5094105,
+              "applyGroupedUpdatesAndDeletes - fail point "
+              "hangAfterRecordingOpApplicationStartTime "
+              "enabled. Blocking until fail point is disabled");
+        hangAfterRecordingOpApplicationStartTime.pauseWhileSet();
+    }
+
+    // applyOperation_inlock does not timestamp writes that have a wrapping WriteUnitOfWork, so
+    // each write must be timestamped here, under the same conditions it would have used.
+    const bool assignTimestamps =
+        ReplicationCoordinator::get(opCtx)->getReplicationMode() ==
+            ReplicationCoordinator::modeReplSet ||
+        oplogApplicationMode == OplogApplication::Mode::kRecovering;
+
+    // See applyOplogEntryOrGroupedInserts for why updates are converted to upserts.
+    const bool shouldAlwaysUpsert = !oplogApplicationEnforcesSteadyStateConstraints &&
+        oplogApplicationMode == OplogApplication::Mode::kSecondary;
+
+    // Only count the operations once the group has committed, since a failed group is applied
+    // again one operation at a time.
+    long long numApplied = 0;
+    auto incrementNumApplied = [&numApplied] { ++numApplied; };
+
+    auto status = writeConflictRetry(opCtx, "applyGroupedUpdatesAndDeletes", nss.ns(), [&] {
+        numApplied = 0;
+
+        AutoGetCollection autoColl(opCtx, getNsOrUUID(nss, firstOp), MODE_IX);
+        auto db = autoColl.getDb();
+        uassert(ErrorCodes::NamespaceNotFound,
+                str::stream() << "missing collection (" << nss << ")",
+                db && autoColl.getCollection());
+        OldClientContext ctx(opCtx, autoColl.getNss().ns(), db);
+
+        WriteUnitOfWork wuow(opCtx);
+        for (auto it = begin; it != end; ++it) {
+            const OplogEntry& op = **it;
+            if (assignTimestamps) {
+                uassertStatusOK(opCtx->recoveryUnit()->setTimestamp(op.getTimestamp()));
+            }
+
+            Status status = applyOperation_inlock(opCtx,
+                                                  db,
+                                                  &op,
+                                                  shouldAlwaysUpsert,
+                                                  oplogApplicationMode,
+                                                  incrementNumApplied,
+                                                  true /* isGroupedUpdateOrDelete */);
+            if (!status.isOK()) {
+                if (status.code() == ErrorCodes::WriteConflict) {
+                    throw WriteConflictException();
+                }
+                return status;
+            }
+        }
+        wuow.commit();
+        return Status::OK();
+    });
+
+    if (status.isOK()) {
+        opsAppliedStats.increment(numApplied);
+    }
+    return finishAndLogApply(
+        opCtx, clockSource, status, applyStartTime, firstOp.getOpType(), [begin, end] {
+            BSONArrayBuilder opsBuilder;
+            for (auto it = begin; it != end; ++it) {
+                opsBuilder.append((*it)->toBSON());
+            }
+            return opsBuilder.arr();
+        });
+}
+
 Status OplogApplierImpl::applyOplogBatchPerWorker(OperationContext* opCtx,
                                                   std::vector<const OplogEntry*>* ops,
                                                   WorkerMultikeyPathInfo* workerMultikeyPathInfo) {
@@ -1049,6 +1156,7 @@ Status OplogApplierImpl::applyOplogBatchPerWorker(OperationContext* opCtx,
     const auto oplogApplicationMode = getOptions().mode;
 
     InsertGroup insertGroup(ops, opCtx, oplogApplicationMode);
+    UpdateDeleteGroup updateDeleteGroup(ops, opCtx, oplogApplicationMode);
 
     {  // Ensure that the MultikeyPathTracker stops tracking paths.
         ON_BLOCK_EXIT([opCtx] { MultikeyPathTracker::get(opCtx).stopTrackingMultikeyPathInfo(); });
@@ -1065,6 +1173,13 @@ Status OplogApplierImpl::applyOplogBatchPerWorker(OperationContext* opCtx,
                 continue;
             }
 
+            // Likewise for a group of updates and deletes on the same collection.
+            auto updateDeleteGroupResult = updateDeleteGroup.groupAndApplyUpdatesAndDeletes(it);
+            if (updateDeleteGroupResult.isOK()) {
+                it = updateDeleteGroupResult.getValue();
+                continue;
+            }
+
             // If we didn't create a group, try to apply the op individually.
             try {
                 const Status status =
@@ -146,5 +146,16 @@ Status applyOplogEntryOrGroupedInserts(OperationContext* opCtx,
                                        const OplogEntryOrGroupedInserts& entryOrGroupedInserts,
                                        OplogApplication::Mode oplogApplicationMode);
 
+/**
+ * Applies the update and delete operations in ['begin', 'end'), which must all target the same
+ * collection, under a single collection lock acquisition and in a single storage transaction. Each
+ * write is timestamped with the time of its own oplog entry. If any operation fails, none of them
+ * take effect.
+ */
+Status applyGroupedUpdatesAndDeletes(OperationContext* opCtx,
+                                     std::vector<const OplogEntry*>::const_iterator begin,
+                                     std::vector<const OplogEntry*>::const_iterator end,
+                                     OplogApplication::Mode oplogApplicationMode);
+
 }  // namespace repl
 }  // namespace mongo
@@ -1970,6 +1970,205 @@ TEST_F(OplogApplierImplTest,
     ASSERT_EQUALS(1U, numFailedGroupedInserts);
 }
 
+/**
+ * Enables grouping of update and delete operations, which is off by default.
+ */
+class OplogApplierImplGroupUpdatesAndDeletesTest : public OplogApplierImplTest {
+protected:
+    void setUp() override {
+        OplogApplierImplTest::setUp();
+        _groupingEnabled = oplogApplicationGroupUpdatesAndDeletes.load();
+        oplogApplicationGroupUpdatesAndDeletes.store(true);
+    }
+
+    void tearDown() override {
+        oplogApplicationGroupUpdatesAndDeletes.store(_groupingEnabled);
+        OplogApplierImplTest::tearDown();
+    }
+
+private:
+    bool _groupingEnabled;
+};
+
+TEST_F(OplogApplierImplGroupUpdatesAndDeletesTest,
+       OplogApplicationThreadFuncAppliesUpdatesAndDeletesOnSameCollectionInOneTransaction) {
+    TestApplyOplogGroupApplier oplogApplier(
+        nullptr, nullptr, OplogApplier::Options(OplogApplication::Mode::kSecondary));
+    NamespaceString nss("test." + _agent.getSuiteName() + "_" + _agent.getTestName());
+    auto createOp = makeCreateCollectionOplogEntry({Timestamp(Seconds(1), 0), 1LL}, nss);
+    auto insertOp1 =
+        makeInsertDocumentOplogEntry({Timestamp(Seconds(2), 0), 1LL}, nss, BSON("_id" << 1));
+    auto insertOp2 =
+        makeInsertDocumentOplogEntry({Timestamp(Seconds(3), 0), 1LL}, nss, BSON("_id" << 2));
+    auto updateOp1 = makeUpdateDocumentOplogEntry(
+        {Timestamp(Seconds(4), 0), 1LL}, nss, BSON("_id" << 1), BSON("_id" << 1 << "x" << 1));
+    auto updateOp2 = makeUpdateDocumentOplogEntry(
+        {Timestamp(Seconds(5), 0), 1LL}, nss, BSON("_id" << 2), BSON("_id" << 2 << "x" << 2));
+    auto deleteOp = makeDeleteDocumentOplogEntry(
+        {Timestamp(Seconds(6), 0), 1LL}, nss, BSON("_id" << 1));
+
+    std::vector<SnapshotId> snapshotIds;
+    _opObserver->onUpdateFn = [&](OperationContext* opCtx, const OplogUpdateEntryArgs&) {
+        snapshotIds.push_back(opCtx->recoveryUnit()->getSnapshotId());
+    };
+    _opObserver->onDeleteFn = [&](OperationContext* opCtx,
+                                  const NamespaceString&,
+                                  OptionalCollectionUUID,
+                                  StmtId,
+                                  bool,
+                                  const boost::optional<BSONObj>&) {
+        snapshotIds.push_back(opCtx->recoveryUnit()->getSnapshotId());
+    };
+
+    std::vector<const OplogEntry*> ops = {
+        &createOp, &insertOp1, &insertOp2, &updateOp1, &updateOp2, &deleteOp};
+    WorkerMultikeyPathInfo pathInfo;
+    ASSERT_OK(oplogApplier.applyOplogBatchPerWorker(_opCtx.get(), &ops, &pathInfo));
+
+    // The updates and the delete were applied in oplog order within a single storage transaction.
+    ASSERT_EQUALS(3U, snapshotIds.size());
+    ASSERT_EQUALS(snapshotIds[0], snapshotIds[1]);
+    ASSERT_EQUALS(snapshotIds[0], snapshotIds[2]);
+
+    CollectionReader collectionReader(_opCtx.get(), nss);
+    ASSERT_BSONOBJ_EQ(BSON("_id" << 2 << "x" << 2), unittest::assertGet(collectionReader.next()));
+    ASSERT_EQUALS(ErrorCodes::CollectionIsEmpty, collectionReader.next().getStatus());
+}
+
+TEST_F(OplogApplierImplGroupUpdatesAndDeletesTest,
+       OplogApplicationThreadFuncGroupsUpdatesAndDeletesStartingAtFirstOperation) {
+    TestApplyOplogGroupApplier oplogApplier(
+        nullptr, nullptr, OplogApplier::Options(OplogApplication::Mode::kSecondary));
+    NamespaceString nss("test." + _agent.getSuiteName() + "_" + _agent.getTestName());
+    createCollection(_opCtx.get(), nss, {});
+    ASSERT_OK(getStorageInterface()->insertDocument(_opCtx.get(), nss, {BSON("_id" << 1)}, 0));
+    ASSERT_OK(getStorageInterface()->insertDocument(_opCtx.get(), nss, {BSON("_id" << 2)}, 0));
+    auto updateOp1 = makeUpdateDocumentOplogEntry(
+        {Timestamp(Seconds(1), 0), 1LL}, nss, BSON("_id" << 1), BSON("_id" << 1 << "x" << 1));
+    auto updateOp2 = makeUpdateDocumentOplogEntry(
+        {Timestamp(Seconds(2), 0), 1LL}, nss, BSON("_id" << 2), BSON("_id" << 2 << "x" << 2));
+    auto deleteOp = makeDeleteDocumentOplogEntry(
+        {Timestamp(Seconds(3), 0), 1LL}, nss, BSON("_id" << 1));
+
+    std::vector<SnapshotId> snapshotIds;
+    _opObserver->onUpdateFn = [&](OperationContext* opCtx, const OplogUpdateEntryArgs&) {
+        snapshotIds.push_back(opCtx->recoveryUnit()->getSnapshotId());
+    };
+    _opObserver->onDeleteFn = [&](OperationContext* opCtx,
+                                  const NamespaceString&,
+                                  OptionalCollectionUUID,
+                                  StmtId,
+                                  bool,
+                                  const boost::optional<BSONObj>&) {
+        snapshotIds.push_back(opCtx->recoveryUnit()->getSnapshotId());
+    };
+
+    auto updatesBefore = replOpCounters.getUpdate()->load();
+    auto deletesBefore = replOpCounters.getDelete()->load();
+
+    // The group starts at the first operation given to the worker.
+    std::vector<const OplogEntry*> ops = {&updateOp1, &updateOp2, &deleteOp};
+    WorkerMultikeyPathInfo pathInfo;
+    ASSERT_OK(oplogApplier.applyOplogBatchPerWorker(_opCtx.get(), &ops, &pathInfo));
+
+    ASSERT_EQUALS(3U, snapshotIds.size());
+    ASSERT_EQUALS(snapshotIds[0], snapshotIds[1]);
+    ASSERT_EQUALS(snapshotIds[0], snapshotIds[2]);
+    ASSERT_EQ(2, replOpCounters.getUpdate()->load() - updatesBefore);
+    ASSERT_EQ(1, replOpCounters.getDelete()->load() - deletesBefore);
+}
+
+TEST_F(OplogApplierImplGroupUpdatesAndDeletesTest,
+       OplogApplicationThreadFuncDoesNotCountOperationsOfFailedGroup) {
+    TestApplyOplogGroupApplier oplogApplier(
+        nullptr, nullptr, OplogApplier::Options(OplogApplication::Mode::kInitialSync));
+    NamespaceString nss("test." + _agent.getSuiteName() + "_" + _agent.getTestName());
+    createCollection(_opCtx.get(), nss, {});
+    ASSERT_OK(getStorageInterface()->insertDocument(_opCtx.get(), nss, {BSON("_id" << 1)}, 0));
+    ASSERT_OK(getStorageInterface()->insertDocument(_opCtx.get(), nss, {BSON("_id" << 2)}, 0));
+    auto updateOp = makeUpdateDocumentOplogEntry(
+        {Timestamp(Seconds(1), 0), 1LL}, nss, BSON("_id" << 1), BSON("_id" << 1 << "x" << 1));
+    // The document updated by this operation is missing, which fails the whole group after the
+    // first update was applied.
+    auto updateMissingOp = makeUpdateDocumentOplogEntry(
+        {Timestamp(Seconds(2), 0), 1LL}, nss, BSON("_id" << 0), BSON("_id" << 0 << "x" << 0));
+    auto deleteOp = makeDeleteDocumentOplogEntry(
+        {Timestamp(Seconds(3), 0), 1LL}, nss, BSON("_id" << 2));
+
+    auto updatesBefore = replOpCounters.getUpdate()->load();
+    auto deletesBefore = replOpCounters.getDelete()->load();
+
+    std::vector<const OplogEntry*> ops = {&updateOp, &updateMissingOp, &deleteOp};
+    WorkerMultikeyPathInfo pathInfo;
+    ASSERT_OK(oplogApplier.applyOplogBatchPerWorker(_opCtx.get(), &ops, &pathInfo));
+
+    // Only the individual application of each operation is counted.
+    ASSERT_EQ(2, replOpCounters.getUpdate()->load() - updatesBefore);
+    ASSERT_EQ(1, replOpCounters.getDelete()->load() - deletesBefore);
+
+    CollectionReader collectionReader(_opCtx.get(), nss);
+    ASSERT_BSONOBJ_EQ(BSON("_id" << 1 << "x" << 1), unittest::assertGet(collectionReader.next()));
+    ASSERT_EQUALS(ErrorCodes::CollectionIsEmpty, collectionReader.next().getStatus());
+}
+
+TEST_F(OplogApplierImplGroupUpdatesAndDeletesTest,
+       OplogApplicationThreadFuncDoesNotReportEmptyDeletesOfFailedGroup) {
+    TestApplyOplogGroupApplier oplogApplier(
+        nullptr, nullptr, OplogApplier::Options(OplogApplication::Mode::kSecondary));
+    NamespaceString nss("test." + _agent.getSuiteName() + "_" + _agent.getTestName());
+    createCollection(_opCtx.get(), nss, {});
+    ASSERT_OK(getStorageInterface()->insertDocument(
+        _opCtx.get(), nss, {BSON("_id" << 1 << "x" << true)}, 0));
+    // The document deleted by this operation is missing, which is only reported in steady state
+    // replication.
+    auto deleteMissingOp = makeDeleteDocumentOplogEntry(
+        {Timestamp(Seconds(1), 0), 1LL}, nss, BSON("_id" << 2));
+    // This update fails the whole group, and then the batch, since 'x' is not numeric.
+    auto badUpdateOp = makeUpdateDocumentOplogEntry({Timestamp(Seconds(2), 0), 1LL},
+                                                    nss,
+                                                    BSON("_id" << 1),
+                                                    BSON("$inc" << BSON("x" << 1)));
+
+    auto deletesWereEmptyBefore = replOpCounters.getDeleteWasEmpty()->load();
+
+    std::vector<const OplogEntry*> ops = {&deleteMissingOp, &badUpdateOp};
+    WorkerMultikeyPathInfo pathInfo;
+    ASSERT_NOT_OK(oplogApplier.applyOplogBatchPerWorker(_opCtx.get(), &ops, &pathInfo));
+
+    // Only the individual application of the delete is reported.
+    ASSERT_EQ(1, replOpCounters.getDeleteWasEmpty()->load() - deletesWereEmptyBefore);
+}
+
+TEST_F(OplogApplierImplGroupUpdatesAndDeletesTest,
+       OplogApplicationThreadFuncFallsBackOnApplyingUpdatesAndDeletesIndividuallyWhenGroupFails) {
+    TestApplyOplogGroupApplier oplogApplier(
+        nullptr, nullptr, OplogApplier::Options(OplogApplication::Mode::kInitialSync));
+    NamespaceString nss("test." + _agent.getSuiteName() + "_" + _agent.getTestName());
+    auto createOp = makeCreateCollectionOplogEntry({Timestamp(Seconds(1), 0), 1LL}, nss);
+    auto insertOp1 =
+        makeInsertDocumentOplogEntry({Timestamp(Seconds(2), 0), 1LL}, nss, BSON("_id" << 1));
+    auto insertOp2 =
+        makeInsertDocumentOplogEntry({Timestamp(Seconds(3), 0), 1LL}, nss, BSON("_id" << 2));
+    // The document updated by this operation is missing, which fails the whole group.
+    auto updateMissingOp = makeUpdateDocumentOplogEntry(
+        {Timestamp(Seconds(4), 0), 1LL}, nss, BSON("_id" << 0), BSON("_id" << 0 << "x" << 0));
+    auto updateOp = makeUpdateDocumentOplogEntry(
+        {Timestamp(Seconds(5), 0), 1LL}, nss, BSON("_id" << 1), BSON("_id" << 1 << "x" << 1));
+    auto deleteOp = makeDeleteDocumentOplogEntry(
+        {Timestamp(Seconds(6), 0), 1LL}, nss, BSON("_id" << 2));
+
+    std::vector<const OplogEntry*> ops = {
+        &createOp, &insertOp1, &insertOp2, &updateMissingOp, &updateOp, &deleteOp};
+    WorkerMultikeyPathInfo pathInfo;
+    ASSERT_OK(oplogApplier.applyOplogBatchPerWorker(_opCtx.get(), &ops, &pathInfo));
+
+    // The update of the missing document is ignored during initial sync, while the remaining
+    // operations are applied individually.
+    CollectionReader collectionReader(_opCtx.get(), nss);
+    ASSERT_BSONOBJ_EQ(BSON("_id" << 1 << "x" << 1), unittest::assertGet(collectionReader.next()));
+    ASSERT_EQUALS(ErrorCodes::CollectionIsEmpty, collectionReader.next().getStatus());
+}
+
 TEST_F(OplogApplierImplTest, ApplyGroupIgnoresUpdateOperationIfDocumentIsMissingFromSyncSource) {
     TestApplyOplogGroupApplier oplogApplier(
         nullptr, nullptr, OplogApplier::Options(OplogApplication::Mode::kInitialSync));
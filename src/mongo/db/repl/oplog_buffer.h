@@ -190,6 +190,14 @@ public:
         size.increment(std::size_t(value.objsize()));
     }
 
+    /**
+     * Accounts for a batch of 'numOps' operations totaling 'numBytes' bytes at once.
+     */
+    void incrementBatch(std::size_t numOps, std::size_t numBytes) {
+        count.increment(numOps);
+        size.increment(numBytes);
+    }
+
     void decrement(const Value& value) {
         count.decrement(1);
         size.decrement(std::size_t(value.objsize()));
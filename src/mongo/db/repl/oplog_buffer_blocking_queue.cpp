@@ -65,13 +65,12 @@ void OplogBufferBlockingQueue::push(OperationContext*,
                                     Batch::const_iterator begin,
                                     Batch::const_iterator end) {
     invariant(!_drainMode);
-    _queue.pushAllBlocking(begin, end);
+    const auto pushedBytes = _queue.pushAllBlocking(begin, end);
     _notEmptyCv.notify_one();
 
+    // Update the server status counters once for the whole batch rather than for each operation.
     if (_counters) {
-        for (auto i = begin; i != end; ++i) {
-            _counters->increment(*i);
-        }
+        _counters->incrementBatch(std::distance(begin, end), pushedBytes);
     }
 }
 
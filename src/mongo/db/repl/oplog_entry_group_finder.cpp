@@ -0,0 +1,96 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/repl/oplog_entry_group_finder.h"
+
+#include <algorithm>
+
+#include "mongo/db/ops/write_ops.h"
+
+namespace mongo {
+namespace repl {
+
+namespace {
+
+// Must not create too large an object or write too much data in a single storage transaction.
+const auto kOplogEntryGroupMaxGroupSize = write_ops::insertVectorMaxBytes;
+
+// Limit number of ops in a single group.
+constexpr auto kOplogEntryGroupMaxOpCount = 64;
+
+}  // namespace
+
+OplogEntryGroupFinder::OplogEntryGroupFinder(std::vector<const OplogEntry*>* ops)
+    : _end(ops->cend()) {}
+
+bool OplogEntryGroupFinder::previouslyAttempted(ConstIterator it) const {
+    return _doNotGroupBeforePoint && it <= *_doNotGroupBeforePoint;
+}
+
+OplogEntryGroupFinder::ConstIterator OplogEntryGroupFinder::findEndOfGroup(
+    ConstIterator it, const IsGroupableFn& isGroupable) const {
+    // Make sure to include the first op in the group size.
+    size_t groupSize = (*it)->getObject().objsize();
+    auto opCount = std::vector<const OplogEntry*>::size_type(1);
+    const auto& groupNamespace = (*it)->getNss();
+
+    /**
+     * Search for the op that delimits this group. For example, given the following list of oplog
+     * entries with a sequence of groupable inserts:
+     *
+     *                S--------------E
+     *       u, u, u, i, i, i, i, i, d, d
+     *
+     *       S: start of group
+     *       E: end of groupable ops
+     *
+     * E is the returned position, i.e. the first op that *can't* be added to the current group.
+     */
+    return std::find_if(it + 1, _end, [&](const OplogEntry* nextEntry) -> bool {
+        groupSize += nextEntry->getObject().objsize();
+        opCount += 1;
+
+        // Only add the op to this group if it passes the criteria.
+        return !isGroupable(*nextEntry)                  // Must be the right kind of op.
+            || nextEntry->getNss() != groupNamespace     // Must be in the same namespace.
+            || groupSize > kOplogEntryGroupMaxGroupSize  // Must not create too large a group.
+            || opCount > kOplogEntryGroupMaxOpCount;     // Limit number of ops in a group.
+    });
+}
+
+void OplogEntryGroupFinder::markFailedGroup(ConstIterator endOfGroup) {
+    // Avoid quadratic run time from a failed group by not retrying until we are beyond this
+    // group of ops.
+    _doNotGroupBeforePoint = endOfGroup - 1;
+}
+
+}  // namespace repl
+}  // namespace mongo
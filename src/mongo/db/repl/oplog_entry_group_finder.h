@@ -0,0 +1,84 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <boost/optional.hpp>
+#include <functional>
+#include <vector>
+
+#include "mongo/db/repl/oplog_entry.h"
+
+namespace mongo {
+namespace repl {
+
+/**
+ * Finds runs of consecutive oplog entries that can be applied together as a group, and remembers
+ * groups that failed to apply so that their operations are not grouped again. Shared by
+ * InsertGroup and UpdateDeleteGroup.
+ */
+class OplogEntryGroupFinder {
+    OplogEntryGroupFinder(const OplogEntryGroupFinder&) = delete;
+    OplogEntryGroupFinder& operator=(const OplogEntryGroupFinder&) = delete;
+
+public:
+    using ConstIterator = std::vector<const OplogEntry*>::const_iterator;
+    using IsGroupableFn = std::function<bool(const OplogEntry&)>;
+
+    explicit OplogEntryGroupFinder(std::vector<const OplogEntry*>* ops);
+
+    /**
+     * Returns true if the operation at 'it' was part of a group that previously failed to apply.
+     */
+    bool previouslyAttempted(ConstIterator it) const;
+
+    /**
+     * Returns the iterator to the first operation after 'it' that cannot be added to the group
+     * starting at 'it'. An operation joins the group if it is on the same namespace as the
+     * operation at 'it', 'isGroupable' returns true for it, and the group stays within the size
+     * and operation count limits.
+     */
+    ConstIterator findEndOfGroup(ConstIterator it, const IsGroupableFn& isGroupable) const;
+
+    /**
+     * Records that the group ending before 'endOfGroup' failed to apply.
+     */
+    void markFailedGroup(ConstIterator endOfGroup);
+
+private:
+    // _doNotGroupBeforePoint is used to prevent retrying bad groups by marking the final op of a
+    // failed group and not allowing further grouping until that op has been processed.
+    boost::optional<ConstIterator> _doNotGroupBeforePoint;
+
+    // Used for constructing search bounds when grouping operations.
+    ConstIterator _end;
+};
+
+}  // namespace repl
+}  // namespace mongo
@@ -557,6 +557,7 @@ StatusWith<OplogFetcher::Documents> OplogFetcher::_getNextBatch() {
             _cursor->more();
         }
 
+        batch.reserve(_cursor->objsLeftInBatch());
         while (_cursor->moreInCurrentBatch()) {
             batch.emplace_back(_cursor->nextSafe());
         }
@@ -35,7 +35,10 @@
 
 #include "mongo/db/repl/replication_recovery.h"
 
+#include "mongo/db/auth/authorization_session.h"
 #include "mongo/db/catalog/document_validation.h"
+#include "mongo/db/client.h"
+#include "mongo/db/commands/server_status.h"
 #include "mongo/db/db_raii.h"
 #include "mongo/db/dbdirectclient.h"
 #include "mongo/db/namespace_string.h"
@@ -53,6 +56,10 @@
 #include "mongo/db/transaction_history_iterator.h"
 #include "mongo/db/transaction_participant.h"
 #include "mongo/logv2/log.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/util/scopeguard.h"
 #include "mongo/util/timer.h"
 
 namespace mongo {
@@ -63,6 +70,78 @@ namespace {
 const auto kRecoveryBatchLogLevel = logv2::LogSeverity::Debug(2);
 const auto kRecoveryOperationLogLevel = logv2::LogSeverity::Debug(3);
 
+/**
+ * Progress of the current or most recent oplog application for replication recovery, reported in
+ * the "replicationRecovery" serverStatus section.
+ */
+class RecoveryProgress {
+public:
+    void begin(const Timestamp& startPoint, const Timestamp& endPoint) {
+        stdx::lock_guard<Latch> lk(_mutex);
+        _inProgress = true;
+        _startPoint = startPoint;
+        _endPoint = endPoint;
+        _lastAppliedOpTime = OpTime();
+        _numBatchesApplied = 0;
+        _numOpsApplied = 0;
+        _timer.reset();
+    }
+
+    void onBatchApplied(std::size_t numOps, const OpTime& lastAppliedOpTime) {
+        stdx::lock_guard<Latch> lk(_mutex);
+        ++_numBatchesApplied;
+        _numOpsApplied += numOps;
+        _lastAppliedOpTime = lastAppliedOpTime;
+    }
+
+    void end() {
+        stdx::lock_guard<Latch> lk(_mutex);
+        _inProgress = false;
+        _duration = Milliseconds(_timer.millis());
+    }
+
+    BSONObj toBSON() const {
+        stdx::lock_guard<Latch> lk(_mutex);
+        BSONObjBuilder builder;
+        builder.append("inProgress", _inProgress);
+        builder.append("startPoint", _startPoint);
+        builder.append("endPoint", _endPoint);
+        builder.append("lastAppliedOpTime", _lastAppliedOpTime.toBSON());
+        builder.append("numBatchesApplied", _numBatchesApplied);
+        builder.append("numOpsApplied", _numOpsApplied);
+        builder.append("durationMillis",
+                       _inProgress ? _timer.millis() : durationCount<Milliseconds>(_duration));
+        return builder.obj();
+    }
+
+private:
+    mutable Mutex _mutex = MONGO_MAKE_LATCH("RecoveryProgress::_mutex");
+    bool _inProgress = false;
+    Timestamp _startPoint;
+    Timestamp _endPoint;
+    OpTime _lastAppliedOpTime;
+    long long _numBatchesApplied = 0;
+    long long _numOpsApplied = 0;
+    Timer _timer;
+    Milliseconds _duration{0};
+};
+
+RecoveryProgress recoveryProgress;
+
+class ReplicationRecoveryServerStatusSection : public ServerStatusSection {
+public:
+    ReplicationRecoveryServerStatusSection() : ServerStatusSection("replicationRecovery") {}
+
+    bool includeByDefault() const override {
+        return true;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx,
+                            const BSONElement& configElement) const override {
+        return recoveryProgress.toBSON();
+    }
+} replicationRecoveryServerStatusSection;
+
 /**
  * Tracks and logs operations applied during recovery.
  */
@@ -101,7 +180,12 @@ public:
         }
     }
 
-    void onBatchEnd(const StatusWith<OpTime>&, const std::vector<OplogEntry>&) final {}
+    void onBatchEnd(const StatusWith<OpTime>& lastOpTimeApplied,
+                    const std::vector<OplogEntry>& batch) final {
+        if (lastOpTimeApplied.isOK()) {
+            recoveryProgress.onBatchApplied(batch.size(), lastOpTimeApplied.getValue());
+        }
+    }
 
     void complete(const OpTime& applyThroughOpTime) const {
         LOGV2(21536,
@@ -229,6 +313,110 @@ private:
     std::unique_ptr<DBClientCursor> _cursor;
 };
 
+/**
+ * Reads batches of operations from an OplogBufferLocalOplog on a dedicated thread, so that the next
+ * batch is read from the local oplog while the current one is being applied. The buffer is only
+ * ever accessed from the prefetching thread.
+ */
+class OplogBatchPrefetcher {
+    OplogBatchPrefetcher(const OplogBatchPrefetcher&) = delete;
+    OplogBatchPrefetcher& operator=(const OplogBatchPrefetcher&) = delete;
+
+public:
+    OplogBatchPrefetcher(OplogApplier* oplogApplier,
+                         OplogBufferLocalOplog* oplogBuffer,
+                         const OplogApplier::BatchLimits& batchLimits)
+        : _oplogApplier(oplogApplier), _oplogBuffer(oplogBuffer), _batchLimits(batchLimits) {}
+
+    ~OplogBatchPrefetcher() {
+        {
+            stdx::lock_guard<Latch> lk(_mutex);
+            _inShutdown = true;
+            _cv.notify_all();
+        }
+        if (_thread.joinable()) {
+            _thread.join();
+        }
+    }
+
+    void startup() {
+        _thread = stdx::thread([this] { _run(); });
+    }
+
+    /**
+     * Returns the next batch of operations, blocking until it has been read. An empty batch means
+     * that the end of the oplog has been reached.
+     */
+    std::vector<OplogEntry> getNextBatch() {
+        stdx::unique_lock<Latch> lk(_mutex);
+        _cv.wait(lk, [&] { return _nextBatch || !_status.isOK(); });
+        uassertStatusOK(_status);
+        auto batch = std::move(*_nextBatch);
+        _nextBatch = boost::none;
+        _cv.notify_all();
+        return batch;
+    }
+
+private:
+    void _run() {
+        Client::initThread("ReplRecoveryOplogPrefetcher");
+        AuthorizationSession::get(cc())->grantInternalAuthorization(&cc());
+        auto opCtx = cc().makeOperationContext();
+
+        // The oplog is not written to while it is being applied for recovery, so reads from it do
+        // not need to wait for the batch being applied to complete.
+        opCtx->lockState()->setShouldConflictWithSecondaryBatchApplication(false);
+
+        try {
+            _oplogBuffer->startup(opCtx.get());
+            ON_BLOCK_EXIT([&] { _oplogBuffer->shutdown(opCtx.get()); });
+
+            while (true) {
+                auto batch =
+                    fassert(50763, _oplogApplier->getNextApplierBatch(opCtx.get(), _batchLimits));
+                const bool reachedEndOfOplog = batch.empty();
+                if (reachedEndOfOplog) {
+                    invariant(_oplogBuffer->isEmpty());
+                }
+
+                stdx::unique_lock<Latch> lk(_mutex);
+                _cv.wait(lk, [&] { return !_nextBatch || _inShutdown; });
+                if (_inShutdown) {
+                    return;
+                }
+                _nextBatch = std::move(batch);
+                _cv.notify_all();
+
+                if (reachedEndOfOplog) {
+                    return;
+                }
+            }
+        } catch (const DBException& ex) {
+            stdx::lock_guard<Latch> lk(_mutex);
+            _status = ex.toStatus();
+            _cv.notify_all();
+        }
+    }
+
+    OplogApplier* const _oplogApplier;
+    OplogBufferLocalOplog* const _oplogBuffer;
+    const OplogApplier::BatchLimits _batchLimits;
+
+    stdx::thread _thread;
+
+    // Protects member data below.
+    Mutex _mutex = MONGO_MAKE_LATCH("OplogBatchPrefetcher::_mutex");
+    stdx::condition_variable _cv;
+
+    // The batch read ahead of the one being applied, if any.
+    boost::optional<std::vector<OplogEntry>> _nextBatch;
+
+    // Set if reading from the oplog failed.
+    Status _status = Status::OK();
+
+    bool _inShutdown = false;
+};
+
 boost::optional<Timestamp> recoverFromOplogPrecursor(OperationContext* opCtx,
                                                      StorageInterface* storageInterface) {
     if (!storageInterface->supportsRecoveryTimestamp(opCtx->getServiceContext())) {
@@ -583,9 +771,10 @@ Timestamp ReplicationRecoveryImpl::_applyOplogOperations(OperationContext* opCtx
           "endPoint"_attr = endPoint);
 
     OplogBufferLocalOplog oplogBuffer(startPoint, endPoint);
-    oplogBuffer.startup(opCtx);
 
     RecoveryOplogApplierStats stats;
+    recoveryProgress.begin(startPoint, endPoint);
+    ON_BLOCK_EXIT([] { recoveryProgress.end(); });
 
     auto writerPool = makeReplWriterPool();
     OplogApplierImpl oplogApplier(nullptr,
@@ -602,17 +791,17 @@ Timestamp ReplicationRecoveryImpl::_applyOplogOperations(OperationContext* opCtx
     batchLimits.ops = getBatchLimitOplogEntries();
 
     OpTime applyThroughOpTime;
-    std::vector<OplogEntry> batch;
-    while (
-        !(batch = fassert(50763, oplogApplier.getNextApplierBatch(opCtx, batchLimits))).empty()) {
-        applyThroughOpTime = uassertStatusOK(oplogApplier.applyOplogBatch(opCtx, std::move(batch)));
+    {
+        OplogBatchPrefetcher prefetcher(&oplogApplier, &oplogBuffer, batchLimits);
+        prefetcher.startup();
+
+        std::vector<OplogEntry> batch;
+        while (!(batch = prefetcher.getNextBatch()).empty()) {
+            applyThroughOpTime =
+                uassertStatusOK(oplogApplier.applyOplogBatch(opCtx, std::move(batch)));
+        }
     }
     stats.complete(applyThroughOpTime);
-    invariant(oplogBuffer.isEmpty(),
-              str::stream() << "Oplog buffer not empty after applying operations. Last operation "
-                               "applied with optime: "
-                            << applyThroughOpTime.toBSON());
-    oplogBuffer.shutdown(opCtx);
 
     // The applied up to timestamp will be null if no oplog entries were applied.
     if (applyThroughOpTime.isNull()) {
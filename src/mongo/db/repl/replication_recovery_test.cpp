@@ -43,6 +43,7 @@
 #include "mongo/db/repl/oplog_applier_impl_test_fixture.h"
 #include "mongo/db/repl/oplog_entry.h"
 #include "mongo/db/repl/oplog_interface_local.h"
+#include "mongo/db/repl/repl_server_parameters_gen.h"
 #include "mongo/db/repl/replication_consistency_markers_mock.h"
 #include "mongo/db/repl/replication_coordinator_mock.h"
 #include "mongo/db/repl/replication_recovery.h"
@@ -56,6 +57,7 @@
 #include "mongo/unittest/death_test.h"
 #include "mongo/unittest/unittest.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/scopeguard.h"
 #include "mongo/util/str.h"
 
 namespace {
@@ -836,6 +838,26 @@ TEST_F(ReplicationRecoveryTest, RecoveryDoesNotApplyOperationsIfAppliedThroughIs
     ASSERT_EQ(OpTime(Timestamp(5, 5), 1), getConsistencyMarkers()->getAppliedThrough(opCtx));
 }
 
+TEST_F(ReplicationRecoveryTest, RecoveryAppliesOperationsAcrossManyPrefetchedBatches) {
+    ReplicationRecoveryImpl recovery(getStorageInterface(), getConsistencyMarkers());
+    auto opCtx = getOperationContext();
+
+    // Force every batch to hold at most two operations so that recovery has to hand off several
+    // batches from the prefetching thread.
+    const auto originalBatchLimit = replBatchLimitOperations.load();
+    replBatchLimitOperations.store(2);
+    ON_BLOCK_EXIT([&] { replBatchLimitOperations.store(originalBatchLimit); });
+
+    _setUpOplog(opCtx, getStorageInterface(), {1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+
+    getStorageInterfaceRecovery()->setRecoveryTimestamp(Timestamp(2, 2));
+    recovery.recoverFromOplog(opCtx, boost::none);
+
+    _assertDocsInOplog(opCtx, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+    _assertDocsInTestCollection(opCtx, {3, 4, 5, 6, 7, 8, 9, 10});
+    ASSERT_EQ(getConsistencyMarkers()->getAppliedThrough(opCtx), OpTime(Timestamp(10, 10), 1));
+}
+
 TEST_F(ReplicationRecoveryTest, RecoveryAppliesUpdatesIdempotently) {
     ReplicationRecoveryImpl recovery(getStorageInterface(), getConsistencyMarkers());
     auto opCtx = getOperationContext();
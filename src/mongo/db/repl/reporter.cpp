@@ -322,6 +322,11 @@ void Reporter::_processResponseCallback(
             _remoteCommandCallbackHandle = executor::TaskExecutor::CallbackHandle();
             return;
         }
+
+        // The command prepared below reads the latest progress, which covers every trigger seen so
+        // far. Clear the flag now so that a trigger arriving while the command is being prepared
+        // causes another update to be sent after this one, rather than waiting for the keep alive.
+        _isWaitingToSendReporter = false;
     }
 
     // Must call without holding the lock.
@@ -340,7 +345,6 @@ void Reporter::_processResponseCallback(
     }
 
     invariant(_remoteCommandCallbackHandle.isValid());
-    _isWaitingToSendReporter = false;
 }
 
 void Reporter::_prepareAndSendCommandCallback(const executor::TaskExecutor::CallbackArgs& args,
@@ -507,6 +507,44 @@ TEST_F(
     ASSERT_FALSE(reporter->isWaitingToSendReport());
 }
 
+// Progress made while the follow-up command is being prepared may not be included in that command,
+// so it must cause yet another command request rather than wait for the keep alive timeout.
+TEST_F(ReporterTest,
+       TriggeringReporterWhilePreparingSecondCommandRequestCausesThirdCommandRequestToBeSent) {
+    // Second trigger (first time in setUp).
+    ASSERT_OK(reporter->trigger());
+    ASSERT_TRUE(reporter->isWaitingToSendReport());
+
+    // Send the first command request.
+    runReadyScheduledTasks();
+
+    int numPrepareCalls = 0;
+    prepareReplSetUpdatePositionCommandFn = [this, &numPrepareCalls] {
+        if (++numPrepareCalls == 1) {
+            // Third trigger, while the second command request is being prepared.
+            ASSERT_OK(reporter->trigger());
+        }
+        return posUpdater->prepareReplSetUpdatePositionCommand();
+    };
+
+    processNetworkResponse(BSON("ok" << 1), true);
+
+    ASSERT_EQUALS(1, numPrepareCalls);
+    ASSERT_TRUE(reporter->isActive());
+    ASSERT_TRUE(reporter->isWaitingToSendReport());
+
+    processNetworkResponse(BSON("ok" << 1), true);
+
+    ASSERT_EQUALS(2, numPrepareCalls);
+    ASSERT_TRUE(reporter->isActive());
+    ASSERT_FALSE(reporter->isWaitingToSendReport());
+
+    processNetworkResponse(BSON("ok" << 1));
+
+    ASSERT_TRUE(reporter->isActive());
+    ASSERT_FALSE(reporter->isWaitingToSendReport());
+}
+
 TEST_F(ReporterTest, ShuttingReporterDownWhileFirstCommandRequestIsInProgressStopsTheReporter) {
     ASSERT_OK(reporter->trigger());
     ASSERT_TRUE(reporter->isActive());
@@ -49,6 +49,8 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/repl/apply_ops.h"
 #include "mongo/db/repl/drop_pending_collection_reaper.h"
+#include "mongo/db/repl/oplog_applier.h"
+#include "mongo/db/repl/repl_server_parameters_gen.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/repl/replication_process.h"
 #include "mongo/db/repl/roll_back_local_operations.h"
@@ -134,6 +136,82 @@ boost::optional<long long> _parseDroppedCollectionCount(const OplogEntry& oplogE
     return count;
 }
 
+/**
+ * Counts the records in the collection with the given UUID by scanning it. Returns boost::none if
+ * the scan fails.
+ */
+boost::optional<long long> countRecordsByScan(OperationContext* opCtx, const UUID& uuid) {
+    const auto coll = CollectionCatalog::get(opCtx).lookupCollectionByUUID(opCtx, uuid);
+    invariant(coll,
+              str::stream() << "The collection with UUID " << uuid
+                            << " is unexpectedly missing in the CollectionCatalog");
+    const auto nss = coll->ns();
+    LOGV2(21602,
+          "Scanning collection {namespace} ({uuid}) to fix collection count.",
+          "Scanning collection to fix collection count",
+          "namespace"_attr = nss.ns(),
+          "uuid"_attr = uuid.toString());
+    AutoGetCollectionForRead autoCollToScan(opCtx, nss);
+    auto collToScan = autoCollToScan.getCollection();
+    invariant(coll == collToScan,
+              str::stream() << "Catalog returned invalid collection: " << nss.ns() << " ("
+                            << uuid.toString() << ")");
+    auto exec = collToScan->makePlanExecutor(
+        opCtx, PlanYieldPolicy::YieldPolicy::INTERRUPT_ONLY, Collection::ScanDirection::kForward);
+    long long countFromScan = 0;
+    PlanExecutor::ExecState state;
+    while (PlanExecutor::ADVANCED ==
+           (state = exec->getNext(static_cast<BSONObj*>(nullptr), nullptr))) {
+        ++countFromScan;
+    }
+    if (PlanExecutor::IS_EOF != state) {
+        LOGV2_WARNING(21637,
+                      "Failed to set count of {namespace} ({uuid}) [{ident}] due to failed "
+                      "collection scan: {error}",
+                      "Failed to set count of namespace due to failed collection scan",
+                      "namespace"_attr = nss.ns(),
+                      "uuid"_attr = uuid.toString(),
+                      "ident"_attr = coll->getRecordStore()->getIdent(),
+                      "error"_attr = exec->statestr(state));
+        return boost::none;
+    }
+    return countFromScan;
+}
+
+/**
+ * Counts the records in each of the given collections by scanning them concurrently on a pool of
+ * replication writer threads. Collections whose scan fails are left out of the result.
+ */
+stdx::unordered_map<UUID, long long, UUID::Hash> countRecordsByScan(
+    OperationContext* opCtx, const std::vector<UUID>& uuids) {
+    stdx::unordered_map<UUID, long long, UUID::Hash> counts;
+    if (uuids.empty()) {
+        return counts;
+    }
+
+    // Each scan writes to its own slot, so the results need no further synchronization.
+    std::vector<boost::optional<long long>> results(uuids.size());
+    {
+        auto writerPool = makeReplWriterPool(
+            std::min(replWriterThreadCount, static_cast<int>(uuids.size())));
+        for (size_t i = 0; i < uuids.size(); ++i) {
+            writerPool->schedule([&uuid = uuids[i], &result = results[i]](auto scheduleStatus) {
+                invariant(scheduleStatus);
+                auto scanOpCtx = cc().makeOperationContext();
+                result = countRecordsByScan(scanOpCtx.get(), uuid);
+            });
+        }
+        writerPool->waitForIdle();
+    }
+
+    for (size_t i = 0; i < uuids.size(); ++i) {
+        if (results[i]) {
+            counts[uuids[i]] = *results[i];
+        }
+    }
+    return counts;
+}
+
 }  // namespace
 
 constexpr const char* RollbackImpl::kRollbackRemoveSaverType;
@@ -561,6 +639,26 @@ void RollbackImpl::_correctRecordStoreCounts(OperationContext* opCtx) {
     // This function explicitly does not check for shutdown since a clean shutdown post oplog
     // truncation is not allowed to occur until the record store counts are corrected.
     const auto& catalog = CollectionCatalog::get(opCtx);
+    auto isMarkedForSizeAdjustment = [&](const UUID& uuid) {
+        const auto coll = catalog.lookupCollectionByUUID(opCtx, uuid);
+        return coll &&
+            sizeRecoveryState(opCtx->getServiceContext())
+                .collectionAlwaysNeedsSizeAdjustment(coll->getRecordStore()->getIdent());
+    };
+
+    // If _findRecordStoreCounts() is unable to determine the correct count from the oplog (most
+    // likely due to a 4.0 drop oplog entry without the count information), we will determine the
+    // correct count here post-recovery using a collection scan. Scanning large collections one at
+    // a time can take a long time, so all the scans are run concurrently up front.
+    std::vector<UUID> uuidsToScan;
+    for (const auto& uiCount : _newCounts) {
+        if (kCollectionScanRequired == uiCount.second &&
+            !isMarkedForSizeAdjustment(uiCount.first)) {
+            uuidsToScan.push_back(uiCount.first);
+        }
+    }
+    const auto countsFromScan = countRecordsByScan(opCtx, uuidsToScan);
+
     for (const auto& uiCount : _newCounts) {
         const auto uuid = uiCount.first;
         const auto coll = catalog.lookupCollectionByUUID(opCtx, uuid);
@@ -594,43 +692,15 @@ void RollbackImpl::_correctRecordStoreCounts(OperationContext* opCtx) {
             continue;
         }
 
-        // If _findRecordStoreCounts() is unable to determine the correct count from the oplog
-        // (most likely due to a 4.0 drop oplog entry without the count information), we will
-        // determine the correct count here post-recovery using a collection scan.
         if (kCollectionScanRequired == newCount) {
-            LOGV2(21602,
-                  "Scanning collection {namespace} ({uuid}) to fix collection count.",
-                  "Scanning collection to fix collection count",
-                  "namespace"_attr = nss.ns(),
-                  "uuid"_attr = uuid.toString());
-            AutoGetCollectionForRead autoCollToScan(opCtx, nss);
-            auto collToScan = autoCollToScan.getCollection();
-            invariant(coll == collToScan,
-                      str::stream() << "Catalog returned invalid collection: " << nss.ns() << " ("
-                                    << uuid.toString() << ")");
-            auto exec = collToScan->makePlanExecutor(opCtx,
-                                                     PlanYieldPolicy::YieldPolicy::INTERRUPT_ONLY,
-                                                     Collection::ScanDirection::kForward);
-            long long countFromScan = 0;
-            PlanExecutor::ExecState state;
-            while (PlanExecutor::ADVANCED ==
-                   (state = exec->getNext(static_cast<BSONObj*>(nullptr), nullptr))) {
-                ++countFromScan;
-            }
-            if (PlanExecutor::IS_EOF != state) {
-                // We ignore errors here because crashing or leaving rollback would only leave
-                // collection counts more inaccurate.
-                LOGV2_WARNING(21637,
-                              "Failed to set count of {namespace} ({uuid}) [{ident}] due to failed "
-                              "collection scan: {error}",
-                              "Failed to set count of namespace due to failed collection scan",
-                              "namespace"_attr = nss.ns(),
-                              "uuid"_attr = uuid.toString(),
-                              "ident"_attr = ident,
-                              "error"_attr = exec->statestr(state));
+            auto it = countsFromScan.find(uuid);
+            if (it == countsFromScan.end()) {
+                // The collection scan failed, which has already been logged. We ignore errors here
+                // because crashing or leaving rollback would only leave collection counts more
+                // inaccurate.
                 continue;
             }
-            newCount = countFromScan;
+            newCount = it->second;
         }
 
         auto status =
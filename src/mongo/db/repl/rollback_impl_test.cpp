@@ -1340,6 +1340,50 @@ TEST_F(RollbackImplTest, CountChangesCancelOut) {
     ASSERT_EQ(_storageInterface->getFinalCollectionCount(uuid), 1);
 }
 
+TEST_F(RollbackImplTest, RollbackScansCollectionsToFixCountsWhenDropEntriesLackCounts) {
+    _storageInterface->setStableTimestamp(nullptr, Timestamp(1, 1));
+
+    const auto commonOp = makeOpAndRecordId(1);
+    _remoteOplog->setOperations({commonOp});
+    ASSERT_OK(_insertOplogEntry(commonOp.first));
+
+    auto uuid1 = UUID::gen();
+    auto nss1 = NamespaceString("test.coll1");
+    const auto coll1 = _initializeCollection(_opCtx.get(), uuid1, nss1);
+    for (int i = 0; i < 2; ++i) {
+        const Timestamp time = Timestamp(2, 2 + i);
+        ASSERT_OK(_storageInterface->insertDocument(
+            _opCtx.get(), {nss1.db().toString(), uuid1}, {BSON("_id" << i), time}, time.asULL()));
+    }
+
+    auto uuid2 = UUID::gen();
+    auto nss2 = NamespaceString("test.coll2");
+    const auto coll2 = _initializeCollection(_opCtx.get(), uuid2, nss2);
+    const Timestamp time2 = Timestamp(2, 4);
+    ASSERT_OK(_storageInterface->insertDocument(
+        _opCtx.get(), {nss2.db().toString(), uuid2}, {BSON("_id" << 0), time2}, time2.asULL()));
+
+    // Drop entries without a collection count require the counts to be fixed by collection scans.
+    ASSERT_OK(_insertOplogEntry(makeCommandOp(Timestamp(3, 3),
+                                              uuid1,
+                                              nss1.getCommandNS().toString(),
+                                              BSON("drop" << nss1.coll()),
+                                              3)
+                                    .first));
+    ASSERT_OK(_insertOplogEntry(makeCommandOp(Timestamp(4, 4),
+                                              uuid2,
+                                              nss2.getCommandNS().toString(),
+                                              BSON("drop" << nss2.coll()),
+                                              4)
+                                    .first));
+
+    _assertDocsInOplog(_opCtx.get(), {1, 3, 4});
+
+    ASSERT_OK(_rollback->runRollback(_opCtx.get()));
+    ASSERT_EQ(_storageInterface->getFinalCollectionCount(uuid1), 2);
+    ASSERT_EQ(_storageInterface->getFinalCollectionCount(uuid2), 1);
+}
+
 TEST_F(RollbackImplTest, RollbackIgnoresSetCollectionCountError) {
     _storageInterface->setStableTimestamp(nullptr, Timestamp(1, 1));
 
@@ -0,0 +1,128 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kReplication
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/repl/update_delete_group.h"
+
+#include <iterator>
+
+#include "mongo/db/repl/oplog_applier_impl.h"
+#include "mongo/db/repl/oplog_entry.h"
+#include "mongo/db/repl/repl_server_parameters_gen.h"
+#include "mongo/logv2/log.h"
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+namespace repl {
+
+namespace {
+
+bool isGroupableOpType(OpTypeEnum opType) {
+    return opType == OpTypeEnum::kUpdate || opType == OpTypeEnum::kDelete;
+}
+
+}  // namespace
+
+UpdateDeleteGroup::UpdateDeleteGroup(std::vector<const OplogEntry*>* ops,
+                                     OperationContext* opCtx,
+                                     UpdateDeleteGroup::Mode mode)
+    : _groupFinder(ops), _opCtx(opCtx), _mode(mode) {}
+
+StatusWith<UpdateDeleteGroup::ConstIterator> UpdateDeleteGroup::groupAndApplyUpdatesAndDeletes(
+    ConstIterator it) {
+    const auto& entry = **it;
+
+    // The following conditions must be met before attempting to group the oplog entries starting
+    // at 'it':
+    // 1) Grouping must be enabled;
+    // 2) The CRUD operation must be an update or a delete;
+    // 3) The namespace cannot be a capped collection or system.views, which needs a stronger lock;
+    // 4) We have not attempted to group this operation during a previous call to this function.
+    if (!oplogApplicationGroupUpdatesAndDeletes.load()) {
+        return Status(ErrorCodes::IllegalOperation,
+                      "Grouping of update and delete operations is disabled.");
+    }
+    if (!isGroupableOpType(entry.getOpType())) {
+        return Status(ErrorCodes::TypeMismatch, "Can only group update and delete operations.");
+    }
+    if (entry.isForCappedCollection || entry.getNss().isSystemDotViews()) {
+        return Status(ErrorCodes::InvalidOptions,
+                      "Cannot group operations on capped collections or views.");
+    }
+    if (_groupFinder.previouslyAttempted(it)) {
+        return Status(ErrorCodes::InvalidPath,
+                      "Cannot group an operation that we previously attempted to group.");
+    }
+
+    const auto& groupNamespace = entry.getNss();
+
+    // Search for the first op that *can't* be added to the current group. The ops were stably
+    // sorted by namespace, so the group keeps the oplog order of the writes to this collection.
+    auto endOfGroupableOpsIterator =
+        _groupFinder.findEndOfGroup(it, [](const OplogEntry& nextEntry) {
+            return isGroupableOpType(nextEntry.getOpType());  // Must be an update or a delete.
+        });
+
+    // See if we were able to create a group that contains more than a single op.
+    if (std::distance(it, endOfGroupableOpsIterator) == 1) {
+        return Status(ErrorCodes::NoSuchKey,
+                      "Not able to create a group with more than a single operation");
+    }
+
+    try {
+        uassertStatusOK(
+            applyGroupedUpdatesAndDeletes(_opCtx, it, endOfGroupableOpsIterator, _mode));
+        return endOfGroupableOpsIterator - 1;
+    } catch (...) {
+        // The storage transaction was rolled back, so none of the operations in the group took
+        // effect. The caller applies them one at a time, which decides whether the failure is
+        // fatal (e.g. an update of a missing document is expected during initial sync).
+        auto status = exceptionToStatus();
+        LOGV2_DEBUG(4934000,
+                    2,
+                    "Error applying updates and deletes as a group. Applying them individually",
+                    "namespace"_attr = groupNamespace,
+                    "numOps"_attr = std::distance(it, endOfGroupableOpsIterator),
+                    "firstOp"_attr = redact(entry.getRaw()),
+                    "error"_attr = redact(status));
+
+        _groupFinder.markFailedGroup(endOfGroupableOpsIterator);
+
+        return status;
+    }
+
+    MONGO_UNREACHABLE;
+}
+
+}  // namespace repl
+}  // namespace mongo
@@ -0,0 +1,75 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#pragma once
+
+#include "mongo/base/status_with.h"
+#include "mongo/db/repl/oplog_applier.h"
+#include "mongo/db/repl/oplog_entry_group_finder.h"
+
+namespace mongo {
+namespace repl {
+
+/**
+ * Groups consecutive update and delete operations on the same namespace and applies them under a
+ * single collection lock acquisition and in a single storage transaction. Each write in the group
+ * is still timestamped with the time of its own oplog entry, and the operations are applied in
+ * oplog order.
+ * Advances the std::vector<const OplogEntry*> iterator if the group is applied successfully.
+ */
+class UpdateDeleteGroup {
+    UpdateDeleteGroup(const UpdateDeleteGroup&) = delete;
+    UpdateDeleteGroup& operator=(const UpdateDeleteGroup&) = delete;
+
+public:
+    using ConstIterator = std::vector<const OplogEntry*>::const_iterator;
+    using Mode = OplogApplication::Mode;
+
+    UpdateDeleteGroup(std::vector<const OplogEntry*>* ops, OperationContext* opCtx, Mode mode);
+
+    /**
+     * Attempts to group update and delete operations starting at 'iter'.
+     * If the group is applied successfully, returns the iterator to the last operation included
+     * in the group. Otherwise, nothing from the group has been applied and the caller must apply
+     * the operation at 'iter' individually.
+     */
+    StatusWith<ConstIterator> groupAndApplyUpdatesAndDeletes(ConstIterator iter);
+
+private:
+    // Finds groupable updates and deletes and remembers groups that failed to apply.
+    OplogEntryGroupFinder _groupFinder;
+
+    // Passed to applyGroupedUpdatesAndDeletes when applying a group.
+    OperationContext* _opCtx;
+    Mode _mode;
+};
+
+}  // namespace repl
+}  // namespace mongo
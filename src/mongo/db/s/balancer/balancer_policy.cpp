@@ -247,6 +247,7 @@ ShardId BalancerPolicy::_getLeastLoadedReceiverShard(const ShardStatisticsVector
                                                      const set<ShardId>& excludedShards) {
     ShardId best;
     unsigned minChunks = numeric_limits<unsigned>::max();
+    uint64_t minSizeMB = numeric_limits<uint64_t>::max();
 
     for (const auto& stat : shardStats) {
         if (excludedShards.count(stat.shardId))
@@ -257,13 +258,15 @@ ShardId BalancerPolicy::_getLeastLoadedReceiverShard(const ShardStatisticsVector
             continue;
         }
 
+        // Among the shards with the fewest chunks, prefer the one storing the least data
         unsigned myChunks = distribution.numberOfChunksInShard(stat.shardId);
-        if (myChunks >= minChunks) {
+        if (myChunks > minChunks || (myChunks == minChunks && stat.currSizeMB >= minSizeMB)) {
             continue;
         }
 
         best = stat.shardId;
         minChunks = myChunks;
+        minSizeMB = stat.currSizeMB;
     }
 
     return best;
@@ -275,18 +278,22 @@ ShardId BalancerPolicy::_getMostOverloadedShard(const ShardStatisticsVector& sha
                                                 const set<ShardId>& excludedShards) {
     ShardId worst;
     unsigned maxChunks = 0;
+    uint64_t maxSizeMB = 0;
 
     for (const auto& stat : shardStats) {
         if (excludedShards.count(stat.shardId))
             continue;
 
+        // Among the shards with the most chunks, prefer the one storing the most data
         const unsigned shardChunkCount =
             distribution.numberOfChunksInShardWithTag(stat.shardId, chunkTag);
-        if (shardChunkCount <= maxChunks)
+        if (shardChunkCount < maxChunks || shardChunkCount == 0 ||
+            (shardChunkCount == maxChunks && stat.currSizeMB <= maxSizeMB))
             continue;
 
         worst = stat.shardId;
         maxChunks = shardChunkCount;
+        maxSizeMB = stat.currSizeMB;
     }
 
     return worst;
@@ -213,7 +213,8 @@ public:
 private:
     /**
      * Return the shard with the specified tag, which has the least number of chunks. If the tag is
-     * empty, considers all shards.
+     * empty, considers all shards. Ties are broken in favour of the shard with the smallest data
+     * size.
      */
     static ShardId _getLeastLoadedReceiverShard(const ShardStatisticsVector& shardStats,
                                                 const DistributionStatus& distribution,
@@ -222,7 +223,8 @@ private:
 
     /**
      * Return the shard which has the least number of chunks with the specified tag. If the tag is
-     * empty, considers all chunks.
+     * empty, considers all chunks. Ties are broken in favour of the shard with the largest data
+     * size.
      */
     static ShardId _getMostOverloadedShard(const ShardStatisticsVector& shardStats,
                                            const DistributionStatus& distribution,
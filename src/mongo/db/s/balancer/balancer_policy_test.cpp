@@ -200,6 +200,30 @@ TEST(BalancerPolicy, ParallelBalancing) {
     ASSERT_EQ(MigrateInfo::chunksImbalance, migrations[1].reason);
 }
 
+TEST(BalancerPolicy, ParallelBalancingBreaksChunkCountTiesByDataSize) {
+    // Same chunk counts as above, but shard1 stores more data than shard0 and shard3 stores less
+    // data than shard2, so shard1 is drained into shard3 first.
+    auto cluster = generateCluster(
+        {{ShardStatistics(kShardId0, kNoMaxSize, 10, false, emptyTagSet, emptyShardVersion), 4},
+         {ShardStatistics(kShardId1, kNoMaxSize, 40, false, emptyTagSet, emptyShardVersion), 4},
+         {ShardStatistics(kShardId2, kNoMaxSize, 5, false, emptyTagSet, emptyShardVersion), 0},
+         {ShardStatistics(kShardId3, kNoMaxSize, 1, false, emptyTagSet, emptyShardVersion), 0}});
+
+    const auto migrations(
+        balanceChunks(cluster.first, DistributionStatus(kNamespace, cluster.second), false, false));
+    ASSERT_EQ(2U, migrations.size());
+
+    ASSERT_EQ(kShardId1, migrations[0].from);
+    ASSERT_EQ(kShardId3, migrations[0].to);
+    ASSERT_BSONOBJ_EQ(cluster.second[kShardId1][0].getMin(), migrations[0].minKey);
+    ASSERT_BSONOBJ_EQ(cluster.second[kShardId1][0].getMax(), migrations[0].maxKey);
+
+    ASSERT_EQ(kShardId0, migrations[1].from);
+    ASSERT_EQ(kShardId2, migrations[1].to);
+    ASSERT_BSONOBJ_EQ(cluster.second[kShardId0][0].getMin(), migrations[1].minKey);
+    ASSERT_BSONOBJ_EQ(cluster.second[kShardId0][0].getMax(), migrations[1].maxKey);
+}
+
 TEST(BalancerPolicy, ParallelBalancingDoesNotPutChunksOnShardsAboveTheOptimal) {
     auto cluster = generateCluster(
         {{ShardStatistics(kShardId0, kNoMaxSize, 100, false, emptyTagSet, emptyShardVersion), 100},
@@ -77,8 +77,14 @@ void ChunkSplitStateDriver::prepareSplit() {
     _stashedBytesWritten = wt->clearBytesWritten();
 }
 
-void ChunkSplitStateDriver::abandonPrepare() {
+void ChunkSplitStateDriver::abandonPrepare(boost::optional<uint64_t> measuredChunkSizeBytes) {
     _stashedBytesWritten = 0;
+
+    if (measuredChunkSizeBytes) {
+        if (auto wt = _writesTracker.lock()) {
+            wt->setMeasuredChunkSize(*measuredChunkSizeBytes);
+        }
+    }
 }
 
 void ChunkSplitStateDriver::commitSplit() {
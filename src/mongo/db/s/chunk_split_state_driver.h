@@ -87,8 +87,11 @@ public:
      * by abandoning the stashed bytes we had written prior to prepare. That
      * way we won't continue to trigger splits on a chunk that is smaller than
      * we currently estimate it to be.
+     *
+     * If the search for split points measured the size of the chunk, it is recorded on the writes
+     * tracker so that the next split is not attempted before the chunk could have grown enough.
      */
-    void abandonPrepare();
+    void abandonPrepare(boost::optional<uint64_t> measuredChunkSizeBytes = boost::none);
 
     /**
      * Marks the split as committed, which means that shouldSplit will
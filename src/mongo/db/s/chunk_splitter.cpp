@@ -328,6 +328,7 @@ void ChunkSplitter::_runAutosplit(std::shared_ptr<ChunkSplitStateDriver> chunkSp
                     "maxChunkSizeBytes"_attr = maxChunkSizeBytes);
 
         chunkSplitStateDriver->prepareSplit();
+        long long chunkSizeBytes = 0;
         auto splitPoints = splitVector(opCtx.get(),
                                        nss,
                                        shardKeyPattern.toBSON(),
@@ -336,7 +337,8 @@ void ChunkSplitter::_runAutosplit(std::shared_ptr<ChunkSplitStateDriver> chunkSp
                                        false,
                                        boost::none,
                                        boost::none,
-                                       maxChunkSizeBytes);
+                                       maxChunkSizeBytes,
+                                       &chunkSizeBytes);
 
         if (splitPoints.empty()) {
             LOGV2_DEBUG(21907,
@@ -347,8 +349,11 @@ void ChunkSplitter::_runAutosplit(std::shared_ptr<ChunkSplitStateDriver> chunkSp
                         "chunk",
                         "chunk"_attr = redact(chunk.toString()));
             // Reset our size estimate that we had prior to splitVector to 0, while still counting
-            // the bytes that have been written in parallel to this split task
-            chunkSplitStateDriver->abandonPrepare();
+            // the bytes that have been written in parallel to this split task. If splitVector had
+            // to scan the chunk, remember its size so that the next scan waits until the chunk may
+            // have grown enough to be split.
+            chunkSplitStateDriver->abandonPrepare(
+                chunkSizeBytes > 0 ? boost::make_optional<uint64_t>(chunkSizeBytes) : boost::none);
             return;
         }
 
@@ -33,12 +33,18 @@
 
 #include "mongo/db/s/migration_chunk_cloner_source_legacy.h"
 
+#include <algorithm>
+#include <functional>
+
 #include "mongo/base/status.h"
 #include "mongo/client/read_preference.h"
+#include "mongo/db/catalog/collection_catalog.h"
 #include "mongo/db/catalog/index_catalog.h"
+#include "mongo/db/catalog/index_catalog_entry.h"
 #include "mongo/db/catalog_raii.h"
 #include "mongo/db/dbhelpers.h"
 #include "mongo/db/exec/working_set_common.h"
+#include "mongo/db/index/index_access_method.h"
 #include "mongo/db/index/index_descriptor.h"
 #include "mongo/db/repl/optime.h"
 #include "mongo/db/repl/replication_process.h"
@@ -47,6 +53,7 @@
 #include "mongo/db/s/sharding_statistics.h"
 #include "mongo/db/s/start_chunk_clone_request.h"
 #include "mongo/db/service_context.h"
+#include "mongo/db/storage/sorted_data_interface.h"
 #include "mongo/executor/remote_command_request.h"
 #include "mongo/executor/remote_command_response.h"
 #include "mongo/executor/task_executor.h"
@@ -119,6 +126,16 @@ char getOpCharForCrudOpType(repl::OpTypeEnum opType) {
     MONGO_UNREACHABLE;
 }
 
+/**
+ * Decodes a KeyString-encoded _id from the xfer mods sets back into an {_id: <value>} document.
+ */
+BSONObj idKeyToBSON(const KeyString::Value& idKey) {
+    const auto idValue = KeyString::toBson(idKey, KeyString::ALL_ASCENDING);
+    BSONObjBuilder idBuilder;
+    idBuilder.appendAs(idValue.firstElement(), "_id");
+    return idBuilder.obj();
+}
+
 }  // namespace
 
 /**
@@ -529,22 +546,34 @@ void MigrationChunkClonerSourceLegacy::_addToTransferModsQueue(
     const char op,
     const repl::OpTime& opTime,
     const repl::OpTime& prePostImageOpTime) {
-    switch (op) {
-        case 'd': {
-            stdx::lock_guard<Latch> sl(_mutex);
-            _deleted.push_back(idObj);
-            _memoryUsed += idObj.firstElement().size() + 5;
-        } break;
+    {
+        // Copying the _id out of the builder gives it a buffer of its own, rather than one shared
+        // with other _ids which it would keep alive after they were dropped.
+        auto idKey =
+            KeyString::Builder(KeyString::Version::kLatestVersion, idObj, KeyString::ALL_ASCENDING)
+                .getValueCopy();
 
-        case 'i':
-        case 'u': {
-            stdx::lock_guard<Latch> sl(_mutex);
-            _reload.push_back(idObj);
-            _memoryUsed += idObj.firstElement().size() + 5;
-        } break;
+        stdx::lock_guard<Latch> sl(_mutex);
+        switch (op) {
+            case 'd': {
+                // A document which no longer exists does not need to be re-cloned. If it gets
+                // inserted again, it will be added back to _reload and since deletes are always
+                // transferred before reloads, the recipient will end up with the new version.
+                if (auto it = _reload.find(idKey); it != _reload.end()) {
+                    _memoryUsed -= sizeof(KeyString::Value) + it->getSize();
+                    _reload.erase(it);
+                }
+                _addToIdSet(sl, &_deleted, std::move(idKey));
+            } break;
 
-        default:
-            MONGO_UNREACHABLE;
+            case 'i':
+            case 'u':
+                _addToIdSet(sl, &_reload, std::move(idKey));
+                break;
+
+            default:
+                MONGO_UNREACHABLE;
+        }
     }
 
     _addToSessionMigrationOptimeQueue(
@@ -662,16 +691,15 @@ void MigrationChunkClonerSourceLegacy::_nextCloneBatchFromCloneLocs(OperationCon
                            Milliseconds(internalQueryExecYieldPeriodMS.load()));
 
     stdx::unique_lock<Latch> lk(_mutex);
-    auto iter = _cloneLocs.begin();
 
-    for (; iter != _cloneLocs.end(); ++iter) {
+    while (!_cloneLocs.empty()) {
         // We must always make progress in this method by at least one document because empty
         // return indicates there is no more initial clone data.
         if (arrBuilder->arrSize() && tracker.intervalHasElapsed()) {
             break;
         }
 
-        auto nextRecordId = *iter;
+        auto nextRecordId = _cloneLocs.back();
 
         lk.unlock();
 
@@ -690,9 +718,10 @@ void MigrationChunkClonerSourceLegacy::_nextCloneBatchFromCloneLocs(OperationCon
         }
 
         lk.lock();
-    }
 
-    _cloneLocs.erase(_cloneLocs.begin(), iter);
+        dassert(_cloneLocs.back() == nextRecordId);
+        _cloneLocs.pop_back();
+    }
 }
 
 uint64_t MigrationChunkClonerSourceLegacy::getCloneBatchBufferAllocationSize() {
@@ -725,12 +754,11 @@ Status MigrationChunkClonerSourceLegacy::nextCloneBatch(OperationContext* opCtx,
 }
 
 Status MigrationChunkClonerSourceLegacy::nextModsBatch(OperationContext* opCtx,
-                                                       Database* db,
                                                        BSONObjBuilder* builder) {
     dassert(opCtx->lockState()->isCollectionLockedForMode(_args.getNss(), MODE_IS));
 
-    std::list<BSONObj> deleteList;
-    std::list<BSONObj> updateList;
+    std::vector<KeyString::Value> deleteList;
+    std::vector<KeyString::Value> updateList;
 
     {
         // All clone data must have been drained before starting to fetch the incremental changes.
@@ -743,23 +771,55 @@ Status MigrationChunkClonerSourceLegacy::nextModsBatch(OperationContext* opCtx,
         // the same doc, then there's no problem since we consume the delete buffer first. If the
         // delete is causally after, we will not be able to see the document when we attempt to
         // fetch it, so it's also ok.
-        deleteList.splice(deleteList.cbegin(), _deleted);
-        updateList.splice(updateList.cbegin(), _reload);
+        _drainIdSet(lk, &_deleted, &deleteList);
+        _drainIdSet(lk, &_reload, &updateList);
     }
 
+    // Transfer the mods in _id order, so that the modified documents are fetched with a single
+    // forward pass over the _id index rather than with random lookups
+    const auto idKeyLess = [](const KeyString::Value& lhs, const KeyString::Value& rhs) {
+        return lhs.compare(rhs) < 0;
+    };
+    std::sort(deleteList.begin(), deleteList.end(), idKeyLess);
+    std::sort(updateList.begin(), updateList.end(), idKeyLess);
+
     auto totalDocSize = _xferDeletes(builder, &deleteList, 0);
-    totalDocSize = _xferUpdates(opCtx, db, builder, &updateList, totalDocSize);
+    totalDocSize = _xferUpdates(opCtx, builder, &updateList, totalDocSize);
 
     builder->append("size", totalDocSize);
 
     // Put back remaining ids we didn't consume
     stdx::unique_lock<Latch> lk(_mutex);
-    _deleted.splice(_deleted.cbegin(), deleteList);
-    _reload.splice(_reload.cbegin(), updateList);
+    for (auto& idKey : deleteList) {
+        _addToIdSet(lk, &_deleted, std::move(idKey));
+    }
+    for (auto& idKey : updateList) {
+        _addToIdSet(lk, &_reload, std::move(idKey));
+    }
 
     return Status::OK();
 }
 
+void MigrationChunkClonerSourceLegacy::_addToIdSet(WithLock,
+                                                   IdKeySet* idSet,
+                                                   KeyString::Value idKey) {
+    const auto size = sizeof(KeyString::Value) + idKey.getSize();
+    if (idSet->insert(std::move(idKey)).second) {
+        _memoryUsed += size;
+    }
+}
+
+void MigrationChunkClonerSourceLegacy::_drainIdSet(WithLock,
+                                                   IdKeySet* idSet,
+                                                   std::vector<KeyString::Value>* idKeys) {
+    idKeys->reserve(idKeys->size() + idSet->size());
+    for (const auto& idKey : *idSet) {
+        _memoryUsed -= sizeof(KeyString::Value) + idKey.getSize();
+        idKeys->push_back(idKey);
+    }
+    idSet->clear();
+}
+
 void MigrationChunkClonerSourceLegacy::_cleanup(OperationContext* opCtx) {
     stdx::unique_lock<Latch> lk(_mutex);
     _state = kDone;
@@ -768,6 +828,7 @@ void MigrationChunkClonerSourceLegacy::_cleanup(OperationContext* opCtx) {
 
     _reload.clear();
     _deleted.clear();
+    _memoryUsed = 0;
 }
 
 StatusWith<BSONObj> MigrationChunkClonerSourceLegacy::_callRecipient(const BSONObj& cmdObj) {
@@ -874,6 +935,10 @@ Status MigrationChunkClonerSourceLegacy::_storeCurrentLocs(OperationContext* opC
     bool isLargeChunk = false;
     unsigned long long recCount = 0;
 
+    // Gather the record ids locally, so that the mutex (which is also taken by the write path
+    // through the op observer) is not acquired once per document
+    std::vector<RecordId> cloneLocs;
+
     try {
         BSONObj obj;
         RecordId recordId;
@@ -884,15 +949,14 @@ Status MigrationChunkClonerSourceLegacy::_storeCurrentLocs(OperationContext* opC
             }
 
             if (!isLargeChunk) {
-                stdx::lock_guard<Latch> lk(_mutex);
-                _cloneLocs.insert(recordId);
+                cloneLocs.push_back(recordId);
             }
 
             if (++recCount > maxRecsWhenFull) {
                 isLargeChunk = true;
+                cloneLocs = std::vector<RecordId>();
 
                 if (_forceJumbo) {
-                    _cloneLocs.clear();
                     break;
                 }
             }
@@ -915,14 +979,20 @@ Status MigrationChunkClonerSourceLegacy::_storeCurrentLocs(OperationContext* opC
                           << _args.getMaxKey()};
     }
 
+    // Sort in descending order, so that the documents are fetched in increasing record id order
+    // by consuming the record ids from the back
+    std::sort(cloneLocs.begin(), cloneLocs.end(), std::greater<RecordId>());
+    cloneLocs.erase(std::unique(cloneLocs.begin(), cloneLocs.end()), cloneLocs.end());
+
     stdx::lock_guard<Latch> lk(_mutex);
+    _cloneLocs = std::move(cloneLocs);
     _averageObjectSizeForCloneLocs = collectionAverageObjectSize + 12;
 
     return Status::OK();
 }
 
 long long MigrationChunkClonerSourceLegacy::_xferDeletes(BSONObjBuilder* builder,
-                                                         std::list<BSONObj>* removeList,
+                                                         std::vector<KeyString::Value>* removeList,
                                                          long long initialSize) {
     const long long maxSize = 1024 * 1024;
 
@@ -935,7 +1005,7 @@ long long MigrationChunkClonerSourceLegacy::_xferDeletes(BSONObjBuilder* builder
 
     auto docIdIter = removeList->begin();
     for (; docIdIter != removeList->end() && totalSize < maxSize; ++docIdIter) {
-        BSONObj idDoc = *docIdIter;
+        BSONObj idDoc = idKeyToBSON(*docIdIter);
         arr.append(idDoc);
         totalSize += idDoc.objsize();
     }
@@ -947,9 +1017,8 @@ long long MigrationChunkClonerSourceLegacy::_xferDeletes(BSONObjBuilder* builder
 }
 
 long long MigrationChunkClonerSourceLegacy::_xferUpdates(OperationContext* opCtx,
-                                                         Database* db,
                                                          BSONObjBuilder* builder,
-                                                         std::list<BSONObj>* updateList,
+                                                         std::vector<KeyString::Value>* updateList,
                                                          long long initialSize) {
     const long long maxSize = 1024 * 1024;
 
@@ -958,18 +1027,51 @@ long long MigrationChunkClonerSourceLegacy::_xferUpdates(OperationContext* opCtx
     }
 
     const auto& nss = _args.getNss();
+    Collection* const collection =
+        CollectionCatalog::get(opCtx).lookupCollectionByNamespace(opCtx, nss);
+    const IndexDescriptor* const idIndex =
+        collection ? collection->getIndexCatalog()->findIdIndex(opCtx) : nullptr;
+    if (!idIndex) {
+        // None of the documents can be found, so there is nothing left to transfer
+        updateList->clear();
+        return initialSize;
+    }
+
+    const IndexCatalogEntry* const idIndexEntry =
+        collection->getIndexCatalog()->getEntry(idIndex);
+    const IndexAccessMethod* const idIam = idIndexEntry->accessMethod();
+
+    // The _id keys are encoded the same way as in the _id index unless the index has a collation
+    // or was built with an older KeyString version, in which case every lookup must go through
+    // the access method so that the key gets re-encoded.
+    const SortedDataInterface* const idSdi = idIam->getSortedDataInterface();
+    std::unique_ptr<SortedDataInterface::Cursor> idCursor;
+    if (!idIndexEntry->getCollator() &&
+        idSdi->getKeyStringVersion() == KeyString::Version::kLatestVersion) {
+        idCursor = idSdi->newCursor(opCtx);
+    }
+
     BSONArrayBuilder arr(builder->subarrayStart("reload"));
     long long totalSize = initialSize;
 
     auto iter = updateList->begin();
     for (; iter != updateList->end() && totalSize < maxSize; ++iter) {
-        auto idDoc = *iter;
+        RecordId loc;
+        if (idCursor) {
+            if (auto entry = idCursor->seekExact(*iter, SortedDataInterface::Cursor::kWantLoc)) {
+                loc = entry->loc;
+            }
+        } else {
+            loc = idIam->findSingle(opCtx, idKeyToBSON(*iter));
+        }
 
-        BSONObj fullDoc;
-        if (Helpers::findById(opCtx, db, nss.ns().c_str(), idDoc, fullDoc)) {
-            arr.append(fullDoc);
-            totalSize += fullDoc.objsize();
+        if (loc.isNull()) {
+            continue;
         }
+
+        BSONObj fullDoc = collection->docFor(opCtx, loc).value();
+        arr.append(fullDoc);
+        totalSize += fullDoc.objsize();
     }
 
     updateList->erase(updateList->begin(), iter);
@@ -29,9 +29,10 @@
 
 #pragma once
 
-#include <list>
+#include <absl/container/flat_hash_set.h>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include "mongo/bson/bsonobj.h"
 #include "mongo/client/connection_string.h"
@@ -41,6 +42,7 @@
 #include "mongo/db/s/migration_chunk_cloner_source.h"
 #include "mongo/db/s/migration_session_id.h"
 #include "mongo/db/s/session_catalog_migration_source.h"
+#include "mongo/db/storage/key_string.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/s/request_types/move_chunk_request.h"
 #include "mongo/s/shard_key_pattern.h"
@@ -169,7 +171,7 @@ public:
      *
      * NOTE: Must be called with the collection lock held in at least IS mode.
      */
-    Status nextModsBatch(OperationContext* opCtx, Database* db, BSONObjBuilder* builder);
+    Status nextModsBatch(OperationContext* opCtx, BSONObjBuilder* builder);
 
     /**
      * Appends to 'arrBuilder' oplog entries which wrote to the currently migrated chunk and contain
@@ -208,6 +210,24 @@ private:
     // Represents the states in which the cloner can be
     enum State { kNew, kCloning, kDone };
 
+    struct IdKeyHash {
+        std::size_t operator()(const KeyString::Value& idKey) const {
+            return idKey.hash();
+        }
+    };
+
+    struct IdKeyEq {
+        bool operator()(const KeyString::Value& lhs, const KeyString::Value& rhs) const {
+            return lhs.compareWithTypeBits(rhs) == 0;
+        }
+    };
+
+    // Deduplicated set of KeyString-encoded _ids of documents modified during the migration, so
+    // that repeated writes to the same document are only transferred once. Each _id owns a buffer
+    // of its own, sized to fit, so that the memory it holds is released as soon as it is dropped
+    // and is fully accounted for in _memoryUsed.
+    using IdKeySet = absl::flat_hash_set<KeyString::Value, IdKeyHash, IdKeyEq>;
+
     /**
      * Idempotent method, which cleans up any previously initialized state. It is safe to be called
      * at any time, but no methods should be called after it.
@@ -233,7 +253,8 @@ private:
 
     /**
      * Get the disklocs that belong to the chunk migrated and sort them in _cloneLocs (to avoid
-     * seeking disk later).
+     * seeking disk later). The record ids are gathered without holding the mutex and are sorted
+     * once, after the whole range has been scanned.
      *
      * Returns OK or any error status otherwise.
      */
@@ -298,24 +319,38 @@ private:
      */
     void _drainAllOutstandingOperationTrackRequests(stdx::unique_lock<Latch>& lk);
 
+    /**
+     * Adds the KeyString-encoded _id to the given xfer mods set, unless it is already present, and
+     * accounts for it in _memoryUsed.
+     */
+    void _addToIdSet(WithLock, IdKeySet* idSet, KeyString::Value idKey);
+
+    /**
+     * Moves all the entries of the given xfer mods set into 'idKeys' and releases them from
+     * _memoryUsed. The entries are not ordered.
+     */
+    void _drainIdSet(WithLock, IdKeySet* idSet, std::vector<KeyString::Value>* idKeys);
+
     /**
      * Appends to the builder the list of _id of documents that were deleted during migration.
-     * Entries appended to the builder are removed from the list.
+     * Entries appended to the builder are removed from the front of the list, which must be sorted
+     * in _id order.
      * Returns the total size of the documents that were appended + initialSize.
      */
     long long _xferDeletes(BSONObjBuilder* builder,
-                           std::list<BSONObj>* removeList,
+                           std::vector<KeyString::Value>* removeList,
                            long long initialSize);
 
     /**
      * Appends to the builder the list of full documents that were modified/inserted during the
-     * migration. Entries appended to the builder are removed from the list.
+     * migration. Entries appended to the builder are removed from the front of the list, which
+     * must be sorted in _id order so that the documents are fetched with a single forward pass
+     * over the _id index.
      * Returns the total size of the documents that were appended + initialSize.
      */
     long long _xferUpdates(OperationContext* opCtx,
-                           Database* db,
                            BSONObjBuilder* builder,
-                           std::list<BSONObj>* updateList,
+                           std::vector<KeyString::Value>* updateList,
                            long long initialSize);
 
     /**
@@ -347,8 +382,10 @@ private:
     // The current state of the cloner
     State _state{kNew};
 
-    // List of record ids that needs to be transferred (initial clone)
-    std::set<RecordId> _cloneLocs;
+    // List of record ids that needs to be transferred (initial clone). They are sorted in
+    // descending order, so that the next one to transfer is at the back and can be consumed with
+    // pop_back.
+    std::vector<RecordId> _cloneLocs;
 
     // The estimated average object size during the clone phase. Used for buffer size
     // pre-allocation (initial clone).
@@ -364,12 +401,12 @@ private:
     // Indicates whether new requests to track an operation are accepted.
     bool _acceptingNewOperationTrackRequests{true};
 
-    // List of _id of documents that were modified that must be re-cloned (xfer mods)
-    std::list<BSONObj> _reload;
+    // Set of _id of documents that were modified that must be re-cloned (xfer mods)
+    IdKeySet _reload;
 
-    // List of _id of documents that were deleted during clone that should be deleted later (xfer
+    // Set of _id of documents that were deleted during clone that should be deleted later (xfer
     // mods)
-    std::list<BSONObj> _deleted;
+    IdKeySet _deleted;
 
     // Total bytes in _reload + _deleted (xfer mods)
     uint64_t _memoryUsed{0};
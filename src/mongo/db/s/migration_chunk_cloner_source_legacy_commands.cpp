@@ -103,11 +103,6 @@ public:
             _autoColl = boost::none;
     }
 
-    Database* getDb() const {
-        invariant(_autoColl);
-        return _autoColl->getDb();
-    }
-
     Collection* getColl() const {
         invariant(_autoColl);
         return _autoColl->getCollection();
@@ -225,7 +220,7 @@ public:
 
         AutoGetActiveCloner autoCloner(opCtx, migrationSessionId, true);
 
-        uassertStatusOK(autoCloner.getCloner()->nextModsBatch(opCtx, autoCloner.getDb(), &result));
+        uassertStatusOK(autoCloner.getCloner()->nextModsBatch(opCtx, &result));
         return true;
     }
 
@@ -397,20 +397,29 @@ repl::OpTime MigrationDestinationManager::cloneDocumentsFromDonor(
     OperationContext* opCtx,
     std::function<void(OperationContext*, BSONObj)> insertBatchFn,
     std::function<BSONObj(OperationContext*)> fetchBatchFn) {
+    const auto numInserterThreads = std::max(1, migrateCloneInsertionThreads.load());
 
-    SingleProducerSingleConsumerQueue<BSONObj>::Options options;
-    options.maxQueueDepth = 1;
+    // Allow the fetcher to get as far ahead as there are inserter threads, so that all of them can
+    // be busy while the next batch is being fetched.
+    SingleProducerMultiConsumerQueue<BSONObj>::Options options;
+    options.maxQueueDepth = numInserterThreads;
 
-    SingleProducerSingleConsumerQueue<BSONObj> batches(options);
+    SingleProducerMultiConsumerQueue<BSONObj> batches(options);
+
+    auto lastOpAppliedMutex = MONGO_MAKE_LATCH("cloneDocumentsFromDonor::lastOpAppliedMutex");
     repl::OpTime lastOpApplied;
 
-    stdx::thread inserterThread{[&] {
+    auto inserterFn = [&] {
         Client::initKillableThread("chunkInserter", opCtx->getServiceContext());
 
         auto inserterOpCtx = Client::getCurrent()->makeOperationContext();
         auto consumerGuard = makeGuard([&] {
             batches.closeConsumerEnd();
-            lastOpApplied = repl::ReplClientInfo::forClient(inserterOpCtx->getClient()).getLastOp();
+
+            const auto& inserterLastOp =
+                repl::ReplClientInfo::forClient(inserterOpCtx->getClient()).getLastOp();
+            stdx::lock_guard<Latch> lk(lastOpAppliedMutex);
+            lastOpApplied = std::max(lastOpApplied, inserterLastOp);
         });
 
         try {
@@ -422,6 +431,9 @@ repl::OpTime MigrationDestinationManager::cloneDocumentsFromDonor(
                 }
                 insertBatchFn(inserterOpCtx.get(), arr);
             }
+        } catch (const ExceptionFor<ErrorCodes::ProducerConsumerQueueEndClosed>&) {
+            // Another inserter thread has consumed the final empty batch or the fetcher has
+            // stopped, in which case it reports its own error.
         } catch (...) {
             stdx::lock_guard<Client> lk(*opCtx->getClient());
             opCtx->getServiceContext()->killOperation(lk, opCtx, ErrorCodes::Error(51008));
@@ -430,15 +442,23 @@ repl::OpTime MigrationDestinationManager::cloneDocumentsFromDonor(
                   "Batch insertion failed",
                   "error"_attr = redact(exceptionToStatus()));
         }
-    }};
+    };
 
+    std::vector<stdx::thread> inserterThreads;
+    inserterThreads.reserve(numInserterThreads);
 
     {
-        auto inserterThreadJoinGuard = makeGuard([&] {
+        auto inserterThreadsJoinGuard = makeGuard([&] {
             batches.closeProducerEnd();
-            inserterThread.join();
+            for (auto& inserterThread : inserterThreads) {
+                inserterThread.join();
+            }
         });
 
+        for (int i = 0; i < numInserterThreads; ++i) {
+            inserterThreads.emplace_back(inserterFn);
+        }
+
         while (true) {
             auto res = fetchBatchFn(opCtx);
             try {
@@ -453,7 +473,7 @@ repl::OpTime MigrationDestinationManager::cloneDocumentsFromDonor(
         }
     }  // This scope ensures that the guard is destroyed
 
-    // This check is necessary because the consumer thread uses killOp to propagate errors to the
+    // This check is necessary because the consumer threads use killOp to propagate errors to the
     // producer thread (this thread)
     opCtx->checkForInterrupt();
     return lastOpApplied;
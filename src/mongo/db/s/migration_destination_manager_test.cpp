@@ -31,6 +31,9 @@
 
 #include "mongo/db/s/migration_destination_manager.h"
 #include "mongo/db/s/shard_server_test_fixture.h"
+#include "mongo/db/s/sharding_runtime_d_params_gen.h"
+#include "mongo/unittest/barrier.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo {
 namespace {
@@ -104,6 +107,58 @@ TEST_F(MigrationDestinationManagerTest, CloneDocumentsFromDonorWorksCorrectly) {
     }
 }
 
+// Tests that batches are inserted concurrently by multiple inserter threads and that all of them
+// get inserted.
+TEST_F(MigrationDestinationManagerTest, CloneDocumentsFromDonorInsertsBatchesConcurrently) {
+    const auto originalInserterThreads = migrateCloneInsertionThreads.load();
+    migrateCloneInsertionThreads.store(2);
+    ON_BLOCK_EXIT([&] { migrateCloneInsertionThreads.store(originalInserterThreads); });
+
+    const int kNumBatches = 10;
+    int numBatchesFetched = 0;
+
+    auto fetchBatchFn = [&](OperationContext* opCtx) {
+        BSONObjBuilder fetchBatchResultBuilder;
+
+        if (numBatchesFetched == kNumBatches) {
+            fetchBatchResultBuilder.append("objects", BSONObj());
+        } else {
+            BSONArrayBuilder arrayBuilder;
+            arrayBuilder.append(createDocument(numBatchesFetched++));
+            fetchBatchResultBuilder.append("objects", arrayBuilder.arr());
+        }
+
+        return fetchBatchResultBuilder.obj();
+    };
+
+    // The first two batches only complete once both of them are being inserted at the same time.
+    unittest::Barrier firstBatchesInserting(2);
+
+    auto mutex = MONGO_MAKE_LATCH();
+    std::vector<int> insertedIds;
+
+    auto insertBatchFn = [&](OperationContext* opCtx, BSONObj docs) {
+        for (auto&& docToClone : docs) {
+            const auto id = docToClone.Obj()["_id"].numberInt();
+            if (id < 2) {
+                firstBatchesInserting.countDownAndWait();
+            }
+
+            stdx::lock_guard<Latch> lk(mutex);
+            insertedIds.push_back(id);
+        }
+    };
+
+    MigrationDestinationManager::cloneDocumentsFromDonor(
+        operationContext(), insertBatchFn, fetchBatchFn);
+
+    std::sort(insertedIds.begin(), insertedIds.end());
+    ASSERT_EQ(static_cast<size_t>(kNumBatches), insertedIds.size());
+    for (int i = 0; i < kNumBatches; ++i) {
+        ASSERT_EQ(i, insertedIds[i]);
+    }
+}
+
 // Tests that an exception in the fetch logic will successfully throw an exception on the main
 // thread.
 TEST_F(MigrationDestinationManagerTest, CloneDocumentsThrowsFetchErrors) {
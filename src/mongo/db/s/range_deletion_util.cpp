@@ -53,10 +53,12 @@
 #include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/query_planner.h"
 #include "mongo/db/repl/repl_client_info.h"
+#include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/repl/wait_for_majority_service.h"
 #include "mongo/db/s/migration_util.h"
 #include "mongo/db/s/persistent_task_store.h"
 #include "mongo/db/s/range_deletion_task_gen.h"
+#include "mongo/db/s/sharding_runtime_d_params_gen.h"
 #include "mongo/db/s/sharding_statistics.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/storage/remove_saver.h"
@@ -72,6 +74,10 @@ const WriteConcernOptions kMajorityWriteConcern(WriteConcernOptions::kMajority,
                                                 WriteConcernOptions::SyncMode::UNSET,
                                                 WriteConcernOptions::kWriteConcernTimeoutSharding);
 
+// The first delay added between batches once range deletion starts backing off because of
+// replication lag
+const Milliseconds kMinThrottleDelay(100);
+
 MONGO_FAIL_POINT_DEFINE(hangBeforeDoingDeletion);
 MONGO_FAIL_POINT_DEFINE(suspendRangeDeletion);
 MONGO_FAIL_POINT_DEFINE(throwWriteConflictExceptionInDeleteRange);
@@ -236,6 +242,47 @@ StatusWith<int> deleteNextBatch(OperationContext* opCtx,
     return numDeleted;
 }
 
+}  // namespace
+
+Milliseconds getMajorityReplicationLag(ServiceContext* serviceContext) {
+    auto const replCoord = repl::ReplicationCoordinator::get(serviceContext);
+    if (!replCoord->isReplEnabled()) {
+        return Milliseconds(0);
+    }
+
+    const auto lastCommitted = replCoord->getLastCommittedOpTimeAndWallTime();
+    if (lastCommitted.wallTime == Date_t()) {
+        return Milliseconds(0);
+    }
+
+    const auto lastApplied = replCoord->getMyLastAppliedOpTimeAndWallTime();
+    return std::max(Milliseconds(0), lastApplied.wallTime - lastCommitted.wallTime);
+}
+
+Milliseconds getNextThrottleDelay(ServiceContext* serviceContext, Milliseconds previousDelay) {
+    const Seconds maxLag(rangeDeleterMaxMajorityLagSecs.load());
+    if (maxLag <= Seconds(0)) {
+        return Milliseconds(0);
+    }
+
+    const auto lag = getMajorityReplicationLag(serviceContext);
+    if (lag <= maxLag) {
+        return Milliseconds(0);
+    }
+
+    const auto delay = std::min(Milliseconds(rangeDeleterMaxThrottleDelayMS.load()),
+                                std::max(kMinThrottleDelay, previousDelay * 2));
+
+    LOGV2_DEBUG(5094100,
+                1,
+                "Throttling range deletion because of majority replication lag",
+                "majorityLag"_attr = lag,
+                "delay"_attr = delay);
+
+    return delay;
+}
+
+namespace {
 
 template <typename Callable>
 auto withTemporaryOperationContext(Callable&& callable) {
@@ -287,7 +334,8 @@ void ensureRangeDeletionTaskStillExists(OperationContext* opCtx, const UUID& mig
 
 /**
  * Delete the range in a sequence of batches until there are no more documents to
- * delete or deletion returns an error.
+ * delete or deletion returns an error. Batches are spaced further apart than delayBetweenBatches
+ * while the majority commit point lags too far behind (see getNextThrottleDelay).
  */
 ExecutorFuture<void> deleteRangeInBatches(const std::shared_ptr<executor::TaskExecutor>& executor,
                                           const NamespaceString& nss,
@@ -297,37 +345,47 @@ ExecutorFuture<void> deleteRangeInBatches(const std::shared_ptr<executor::TaskEx
                                           const boost::optional<UUID>& migrationId,
                                           int numDocsToRemovePerBatch,
                                           Milliseconds delayBetweenBatches) {
-    return AsyncTry([=] {
-               return withTemporaryOperationContext([=](OperationContext* opCtx) {
-                   if (migrationId) {
-                       ensureRangeDeletionTaskStillExists(opCtx, *migrationId);
-                   }
+    auto throttleDelay = std::make_shared<Milliseconds>(0);
 
-                   AutoGetCollection autoColl(opCtx, nss, MODE_IX);
-                   auto* const collection = autoColl.getCollection();
-
-                   // Ensure the collection exists and has not been dropped or dropped and
-                   // recreated.
-                   uassert(ErrorCodes::RangeDeletionAbandonedBecauseCollectionWithUUIDDoesNotExist,
+    return AsyncTry([=] {
+               *throttleDelay = getNextThrottleDelay(getGlobalServiceContext(), *throttleDelay);
+               auto throttled = *throttleDelay > Milliseconds(0)
+                   ? sleepFor(executor, *throttleDelay)
+                   : ExecutorFuture<void>(executor);
+
+               return std::move(throttled).then([=] {
+                   return withTemporaryOperationContext([=](OperationContext* opCtx) {
+                       if (migrationId) {
+                           ensureRangeDeletionTaskStillExists(opCtx, *migrationId);
+                       }
+
+                       AutoGetCollection autoColl(opCtx, nss, MODE_IX);
+                       auto* const collection = autoColl.getCollection();
+
+                       // Ensure the collection exists and has not been dropped or dropped and
+                       // recreated.
+                       uassert(
+                           ErrorCodes::RangeDeletionAbandonedBecauseCollectionWithUUIDDoesNotExist,
                            "Collection has been dropped since enqueuing this range "
                            "deletion task. No need to delete documents.",
                            !collectionUuidHasChanged(nss, collection, collectionUuid));
 
-                   auto numDeleted = uassertStatusOK(deleteNextBatch(
-                       opCtx, collection, keyPattern, range, numDocsToRemovePerBatch));
-
-                   LOGV2_DEBUG(
-                       23769,
-                       2,
-                       "Deleted {numDeleted} documents in pass in namespace {namespace} with "
-                       "UUID  {collectionUUID} for range {range}",
-                       "Deleted documents in pass",
-                       "numDeleted"_attr = numDeleted,
-                       "namespace"_attr = nss.ns(),
-                       "collectionUUID"_attr = collectionUuid,
-                       "range"_attr = range.toString());
-
-                   return numDeleted;
+                       auto numDeleted = uassertStatusOK(deleteNextBatch(
+                           opCtx, collection, keyPattern, range, numDocsToRemovePerBatch));
+
+                       LOGV2_DEBUG(
+                           23769,
+                           2,
+                           "Deleted {numDeleted} documents in pass in namespace {namespace} with "
+                           "UUID  {collectionUUID} for range {range}",
+                           "Deleted documents in pass",
+                           "numDeleted"_attr = numDeleted,
+                           "namespace"_attr = nss.ns(),
+                           "collectionUUID"_attr = collectionUuid,
+                           "range"_attr = range.toString());
+
+                       return numDeleted;
+                   });
                });
            })
         .until([](StatusWith<int> swNumDeleted) {
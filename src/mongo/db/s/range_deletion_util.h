@@ -39,6 +39,7 @@
 namespace mongo {
 
 class BSONObj;
+class ServiceContext;
 
 // The maximum number of documents to delete in a single batch during range deletion.
 // secondaryThrottle and rangeDeleterBatchDelayMS apply between each batch.
@@ -50,6 +51,20 @@ extern AtomicWord<int> rangeDeleterBatchSize;
 // next batch of deletions.
 extern AtomicWord<int> rangeDeleterBatchDelayMS;
 
+/**
+ * Returns how far the majority commit point lags behind the last operation applied on this node, in
+ * wall clock time, or zero if the node does not know of a majority commit point yet.
+ */
+Milliseconds getMajorityReplicationLag(ServiceContext* serviceContext);
+
+/**
+ * Returns the extra delay to wait for before deleting the next batch, given the delay which was
+ * waited for before the previous one. Range deletion backs off exponentially for as long as the
+ * majority commit point lags by more than rangeDeleterMaxMajorityLagSecs, so that orphan cleanup
+ * does not add to the lag which foreground writes with majority write concern are waiting on.
+ */
+Milliseconds getNextThrottleDelay(ServiceContext* serviceContext, Milliseconds previousDelay);
+
 /**
  * Deletes a range of orphaned documents for the given namespace and collection UUID. Returns a
  * future which will be resolved when the range has finished being deleted. The resulting future
@@ -61,7 +76,9 @@ extern AtomicWord<int> rangeDeleterBatchDelayMS;
  * 2. Waits for delayForActiveQueriesOnSecondariesToComplete seconds before deleting any documents,
  *    to give queries running on secondaries a chance to finish.
  * 3. Delete documents in a series of batches with up to numDocsToRemovePerBatch documents per
- *    batch, with a delay of delayBetweenBatches milliseconds in between batches.
+ *    batch, with a delay of delayBetweenBatches milliseconds in between batches. While the majority
+ *    commit point lags by more than rangeDeleterMaxMajorityLagSecs, an additional, exponentially
+ *    growing delay is waited for before each batch.
  */
 SharedSemiFuture<void> removeDocumentsInRange(
     const std::shared_ptr<executor::TaskExecutor>& executor,
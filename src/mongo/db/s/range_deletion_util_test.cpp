@@ -911,5 +911,113 @@ TEST_F(RangeDeleterTest, RemoveDocumentsInRangeDoesNotCrashWhenShardKeyIndexDoes
     cleanupComplete.get();
 }
 
+const Date_t kLastAppliedWallTime = Date_t::fromMillisSinceEpoch(1000000);
+
+/**
+ * Reports a majority commit point which lags behind the last operation applied on this node by
+ * 'lag' of wall clock time.
+ */
+class LaggingReplicationCoordinatorMock : public repl::ReplicationCoordinatorMock {
+public:
+    LaggingReplicationCoordinatorMock(ServiceContext* service, Milliseconds lag)
+        : repl::ReplicationCoordinatorMock(service), _lag(lag) {
+        _setLastApplied();
+    }
+
+    LaggingReplicationCoordinatorMock(ServiceContext* service,
+                                      const repl::ReplSettings& settings,
+                                      Milliseconds lag)
+        : repl::ReplicationCoordinatorMock(service, settings), _lag(lag) {
+        _setLastApplied();
+    }
+
+    repl::OpTimeAndWallTime getLastCommittedOpTimeAndWallTime() const override {
+        return {repl::OpTime(Timestamp(50, 1), 1), kLastAppliedWallTime - _lag};
+    }
+
+private:
+    void _setLastApplied() {
+        setMyLastAppliedOpTimeAndWallTime(
+            {repl::OpTime(Timestamp(100, 1), 1), kLastAppliedWallTime});
+    }
+
+    const Milliseconds _lag;
+};
+
+class RangeDeleterThrottleTest : public RangeDeleterTest {
+public:
+    void setUp() override {
+        RangeDeleterTest::setUp();
+
+        _originalMaxMajorityLagSecs = rangeDeleterMaxMajorityLagSecs.load();
+        _originalMaxThrottleDelayMS = rangeDeleterMaxThrottleDelayMS.load();
+        rangeDeleterMaxMajorityLagSecs.store(10);
+        rangeDeleterMaxThrottleDelayMS.store(1000);
+    }
+
+    void tearDown() override {
+        rangeDeleterMaxMajorityLagSecs.store(_originalMaxMajorityLagSecs);
+        rangeDeleterMaxThrottleDelayMS.store(_originalMaxThrottleDelayMS);
+
+        RangeDeleterTest::tearDown();
+    }
+
+    void setMajorityReplicationLag(Milliseconds lag) {
+        repl::ReplicationCoordinator::set(
+            getServiceContext(),
+            std::make_unique<LaggingReplicationCoordinatorMock>(getServiceContext(), lag));
+    }
+
+private:
+    int _originalMaxMajorityLagSecs;
+    int _originalMaxThrottleDelayMS;
+};
+
+TEST_F(RangeDeleterThrottleTest, ThrottleDelayGrowsUpToMaxWhileMajorityLags) {
+    setMajorityReplicationLag(Seconds(20));
+    ASSERT_EQ(Milliseconds(Seconds(20)), getMajorityReplicationLag(getServiceContext()));
+
+    Milliseconds delay(0);
+    for (auto expectedDelay : {100, 200, 400, 800, 1000, 1000}) {
+        delay = getNextThrottleDelay(getServiceContext(), delay);
+        ASSERT_EQ(Milliseconds(expectedDelay), delay);
+    }
+}
+
+TEST_F(RangeDeleterThrottleTest, ThrottleDelayResetsOnceMajorityCatchesUp) {
+    setMajorityReplicationLag(Seconds(20));
+    auto delay = getNextThrottleDelay(getServiceContext(), Milliseconds(400));
+    ASSERT_EQ(Milliseconds(800), delay);
+
+    setMajorityReplicationLag(Seconds(1));
+    delay = getNextThrottleDelay(getServiceContext(), delay);
+    ASSERT_EQ(Milliseconds(0), delay);
+
+    // Backing off again starts over from the smallest delay
+    setMajorityReplicationLag(Seconds(20));
+    ASSERT_EQ(Milliseconds(100), getNextThrottleDelay(getServiceContext(), delay));
+}
+
+TEST_F(RangeDeleterThrottleTest, NoThrottleWhileLagIsUnderThreshold) {
+    setMajorityReplicationLag(Seconds(5));
+    ASSERT_EQ(Milliseconds(0), getNextThrottleDelay(getServiceContext(), Milliseconds(0)));
+    ASSERT_EQ(Milliseconds(0), getNextThrottleDelay(getServiceContext(), Milliseconds(400)));
+}
+
+TEST_F(RangeDeleterThrottleTest, NoThrottleWhenDisabled) {
+    rangeDeleterMaxMajorityLagSecs.store(0);
+    setMajorityReplicationLag(Seconds(20));
+    ASSERT_EQ(Milliseconds(0), getNextThrottleDelay(getServiceContext(), Milliseconds(400)));
+}
+
+TEST_F(RangeDeleterThrottleTest, NoThrottleOnStandalone) {
+    repl::ReplicationCoordinator::set(
+        getServiceContext(),
+        std::make_unique<LaggingReplicationCoordinatorMock>(
+            getServiceContext(), repl::ReplSettings(), Seconds(20)));
+    ASSERT_EQ(Milliseconds(0), getMajorityReplicationLag(getServiceContext()));
+    ASSERT_EQ(Milliseconds(0), getNextThrottleDelay(getServiceContext(), Milliseconds(400)));
+}
+
 }  // namespace
 }  // namespace mongo
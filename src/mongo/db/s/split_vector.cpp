@@ -66,7 +66,8 @@ std::vector<BSONObj> splitVector(OperationContext* opCtx,
                                  bool force,
                                  boost::optional<long long> maxSplitPoints,
                                  boost::optional<long long> maxChunkObjects,
-                                 boost::optional<long long> maxChunkSizeBytes) {
+                                 boost::optional<long long> maxChunkSizeBytes,
+                                 long long* chunkSizeBytes) {
     std::vector<BSONObj> splitKeys;
     std::size_t splitVectorResponseSize = 0;
 
@@ -328,6 +329,11 @@ std::vector<BSONObj> splitVector(OperationContext* opCtx,
         // Remove the sentinel at the beginning before returning
         splitKeys.erase(splitKeys.begin());
 
+        // Without any split point, the whole range was scanned and currCount is its number of keys
+        if (chunkSizeBytes && splitKeys.empty()) {
+            *chunkSizeBytes = currCount * avgRecSize;
+        }
+
         if (timer.millis() > serverGlobalParams.slowMS) {
             LOGV2_WARNING(
                 22115,
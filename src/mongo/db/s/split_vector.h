@@ -55,6 +55,8 @@ class StatusWith;
  * be specified.
  * If force is set, split at the halfway point of the chunk. This also effectively
  * makes maxChunkSize equal the size of the chunk.
+ * If chunkSizeBytes is not null and the chunk had to be scanned without finding any split point,
+ * it is set to the size of the chunk estimated from its number of keys.
  */
 std::vector<BSONObj> splitVector(OperationContext* opCtx,
                                  const NamespaceString& nss,
@@ -64,6 +66,7 @@ std::vector<BSONObj> splitVector(OperationContext* opCtx,
                                  bool force,
                                  boost::optional<long long> maxSplitPoints,
                                  boost::optional<long long> maxChunkObjects,
-                                 boost::optional<long long> maxChunkSizeBytes);
+                                 boost::optional<long long> maxChunkSizeBytes,
+                                 long long* chunkSizeBytes = nullptr);
 
 }  // namespace mongo
@@ -59,8 +59,22 @@ Date_t MockServiceLiaisonImpl::now() const {
 }
 
 void MockServiceLiaisonImpl::scheduleJob(PeriodicRunner::PeriodicJob job) {
-    // The cache should be refreshed from tests by calling refreshNow().
-    return;
+    // The jobs are never run on their own. The cache should be refreshed from tests by calling
+    // refreshNow(), or by explicitly running one of the scheduled jobs through runScheduledJob().
+    stdx::unique_lock<Latch> lk(_mutex);
+    _scheduledJobs.push_back(std::move(job));
+}
+
+void MockServiceLiaisonImpl::runScheduledJob(StringData name, Client* client) {
+    stdx::unique_lock<Latch> lk(_mutex);
+    auto it = std::find_if(_scheduledJobs.begin(), _scheduledJobs.end(), [&](const auto& job) {
+        return job.name == name;
+    });
+    invariant(it != _scheduledJobs.end());
+    auto job = it->job;
+    lk.unlock();
+
+    job(client);
 }
 
 
@@ -77,6 +77,11 @@ public:
     void fastForward(Milliseconds time);
     int jobs();
 
+    /**
+     * Runs once, on the calling thread, the job with the given name passed to scheduleJob().
+     */
+    void runScheduledJob(StringData name, Client* client);
+
     const KillAllSessionsByPattern* matchKilled(const LogicalSessionId& lsid);
     std::pair<Status, int> killCursorsWithMatchingSessions(OperationContext* opCtx,
                                                            const SessionKiller::Matcher& matcher);
@@ -90,6 +95,7 @@ private:
     mutable Mutex _mutex = MONGO_MAKE_LATCH("MockServiceLiaisonImpl::_mutex");
     LogicalSessionIdSet _activeSessions;
     LogicalSessionIdSet _cursorSessions;
+    std::vector<PeriodicRunner::PeriodicJob> _scheduledJobs;
 };
 
 /**
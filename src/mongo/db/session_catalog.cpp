@@ -49,17 +49,21 @@ const auto operationSessionDecoration =
 }  // namespace
 
 SessionCatalog::~SessionCatalog() {
-    stdx::lock_guard<Latch> lg(_mutex);
-    for (const auto& entry : _sessions) {
-        ObservableSession session(lg, entry.second->session);
-        invariant(!session.currentOperation());
-        invariant(!session._killed());
+    for (auto& stripe : _stripes) {
+        stdx::lock_guard<Latch> lg(stripe.mutex);
+        for (const auto& entry : stripe.sessions) {
+            ObservableSession session(lg, entry.second->session);
+            invariant(!session.currentOperation());
+            invariant(!session._killed());
+        }
     }
 }
 
 void SessionCatalog::reset_forTest() {
-    stdx::lock_guard<Latch> lg(_mutex);
-    _sessions.clear();
+    for (auto& stripe : _stripes) {
+        stdx::lock_guard<Latch> lg(stripe.mutex);
+        stripe.sessions.clear();
+    }
 }
 
 SessionCatalog* SessionCatalog::get(OperationContext* opCtx) {
@@ -79,8 +83,11 @@ SessionCatalog::ScopedCheckedOutSession SessionCatalog::_checkOutSession(Operati
     invariant(!opCtx->lockState()->inAWriteUnitOfWork());
     invariant(!opCtx->lockState()->isLocked());
 
-    stdx::unique_lock<Latch> ul(_mutex);
-    auto sri = _getOrCreateSessionRuntimeInfo(ul, opCtx, *opCtx->getLogicalSessionId());
+    const auto& lsid = *opCtx->getLogicalSessionId();
+    auto& stripe = _getStripe(lsid);
+
+    stdx::unique_lock<Latch> ul(stripe.mutex);
+    auto sri = _getOrCreateSessionRuntimeInfo(ul, stripe, opCtx, lsid);
 
     // Wait until the session is no longer checked out and until the previously scheduled kill has
     // completed
@@ -106,8 +113,10 @@ SessionCatalog::SessionToKill SessionCatalog::checkOutSessionForKill(OperationCo
     invariant(!operationSessionDecoration(opCtx));
     invariant(!opCtx->getTxnNumber());
 
-    stdx::unique_lock<Latch> ul(_mutex);
-    auto sri = _getOrCreateSessionRuntimeInfo(ul, opCtx, killToken.lsidToKill);
+    auto& stripe = _getStripe(killToken.lsidToKill);
+
+    stdx::unique_lock<Latch> ul(stripe.mutex);
+    auto sri = _getOrCreateSessionRuntimeInfo(ul, stripe, opCtx, killToken.lsidToKill);
     invariant(ObservableSession(ul, sri->session)._killed());
 
     // Wait until the session is no longer checked out
@@ -130,9 +139,11 @@ void SessionCatalog::scanSession(const LogicalSessionId& lsid,
     std::unique_ptr<SessionRuntimeInfo> sessionToReap;
 
     {
-        stdx::lock_guard<Latch> lg(_mutex);
-        auto it = _sessions.find(lsid);
-        if (it != _sessions.end()) {
+        auto& stripe = _getStripe(lsid);
+
+        stdx::lock_guard<Latch> lg(stripe.mutex);
+        auto it = stripe.sessions.find(lsid);
+        if (it != stripe.sessions.end()) {
             auto& sri = it->second;
             ObservableSession osession(lg, sri->session);
             workerFn(osession);
@@ -140,7 +151,7 @@ void SessionCatalog::scanSession(const LogicalSessionId& lsid,
             if (osession._markedForReap && !osession._killed() && !osession.currentOperation() &&
                 !sri->numWaitingToCheckOut) {
                 sessionToReap = std::move(sri);
-                _sessions.erase(it);
+                stripe.sessions.erase(it);
             }
         }
     }
@@ -150,16 +161,17 @@ void SessionCatalog::scanSessions(const SessionKiller::Matcher& matcher,
                                   const ScanSessionsCallbackFn& workerFn) {
     std::vector<std::unique_ptr<SessionRuntimeInfo>> sessionsToReap;
 
-    {
-        stdx::lock_guard<Latch> lg(_mutex);
+    LOGV2_DEBUG(21976,
+                2,
+                "Scanning {sessionCount} sessions",
+                "Scanning sessions",
+                "sessionCount"_attr = size());
 
-        LOGV2_DEBUG(21976,
-                    2,
-                    "Scanning {sessionCount} sessions",
-                    "Scanning sessions",
-                    "sessionCount"_attr = _sessions.size());
+    // The stripes are visited one at a time, so at most one stripe mutex is held at any point
+    for (auto& stripe : _stripes) {
+        stdx::lock_guard<Latch> lg(stripe.mutex);
 
-        for (auto it = _sessions.begin(); it != _sessions.end(); ++it) {
+        for (auto it = stripe.sessions.begin(); it != stripe.sessions.end(); ++it) {
             if (matcher.match(it->first)) {
                 auto& sri = it->second;
                 ObservableSession osession(lg, sri->session);
@@ -169,7 +181,7 @@ void SessionCatalog::scanSessions(const SessionKiller::Matcher& matcher,
                 if (osession._markedForReap && !osession._killed() &&
                     !osession.currentOperation() && !sri->numWaitingToCheckOut) {
                     sessionsToReap.emplace_back(std::move(sri));
-                    _sessions.erase(it++);
+                    stripe.sessions.erase(it++);
                 }
             }
         }
@@ -177,24 +189,34 @@ void SessionCatalog::scanSessions(const SessionKiller::Matcher& matcher,
 }
 
 SessionCatalog::KillToken SessionCatalog::killSession(const LogicalSessionId& lsid) {
-    stdx::lock_guard<Latch> lg(_mutex);
-    auto it = _sessions.find(lsid);
-    uassert(ErrorCodes::NoSuchSession, "Session not found", it != _sessions.end());
+    auto& stripe = _getStripe(lsid);
+
+    stdx::lock_guard<Latch> lg(stripe.mutex);
+    auto it = stripe.sessions.find(lsid);
+    uassert(ErrorCodes::NoSuchSession, "Session not found", it != stripe.sessions.end());
 
     auto& sri = it->second;
     return ObservableSession(lg, sri->session).kill();
 }
 
 size_t SessionCatalog::size() const {
-    stdx::lock_guard<Latch> lg(_mutex);
-    return _sessions.size();
+    size_t numSessions = 0;
+    for (const auto& stripe : _stripes) {
+        stdx::lock_guard<Latch> lg(stripe.mutex);
+        numSessions += stripe.sessions.size();
+    }
+    return numSessions;
+}
+
+SessionCatalog::Stripe& SessionCatalog::_getStripe(const LogicalSessionId& lsid) {
+    return _stripes[LogicalSessionIdHash()(lsid) % kNumStripes];
 }
 
 SessionCatalog::SessionRuntimeInfo* SessionCatalog::_getOrCreateSessionRuntimeInfo(
-    WithLock, OperationContext* opCtx, const LogicalSessionId& lsid) {
-    auto it = _sessions.find(lsid);
-    if (it == _sessions.end()) {
-        it = _sessions.emplace(lsid, std::make_unique<SessionRuntimeInfo>(lsid)).first;
+    WithLock, Stripe& stripe, OperationContext* opCtx, const LogicalSessionId& lsid) {
+    auto it = stripe.sessions.find(lsid);
+    if (it == stripe.sessions.end()) {
+        it = stripe.sessions.emplace(lsid, std::make_unique<SessionRuntimeInfo>(lsid)).first;
     }
 
     return it->second.get();
@@ -202,11 +224,13 @@ SessionCatalog::SessionRuntimeInfo* SessionCatalog::_getOrCreateSessionRuntimeIn
 
 void SessionCatalog::_releaseSession(SessionRuntimeInfo* sri,
                                      boost::optional<KillToken> killToken) {
-    stdx::lock_guard<Latch> lg(_mutex);
+    auto& stripe = _getStripe(sri->session.getSessionId());
+
+    stdx::lock_guard<Latch> lg(stripe.mutex);
 
     // Make sure we have exactly the same session on the map and that it is still associated with an
     // operation context (meaning checked-out)
-    invariant(_sessions[sri->session.getSessionId()].get() == sri);
+    invariant(stripe.sessions[sri->session.getSessionId()].get() == sri);
     invariant(sri->session._checkoutOpCtx);
     sri->session._checkoutOpCtx = nullptr;
     sri->availableCondVar.notify_all();
@@ -301,7 +325,7 @@ void OperationContextSession::checkIn(OperationContext* opCtx) {
     invariant(checkedOutSession);
 
     // Removing the checkedOutSession from the OperationContext must be done under the Client lock,
-    // but destruction of the checkedOutSession must not be, as it takes the SessionCatalog mutex,
+    // but destruction of the checkedOutSession must not be, as it takes a SessionCatalog mutex,
     // and other code may take the Client lock while holding that mutex.
     stdx::unique_lock<Client> lk(*opCtx->getClient());
     SessionCatalog::ScopedCheckedOutSession sessionToReleaseOutOfLock(
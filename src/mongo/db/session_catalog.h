@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <array>
 #include <boost/optional.hpp>
 #include <vector>
 
@@ -42,6 +43,7 @@
 #include "mongo/stdx/unordered_map.h"
 #include "mongo/util/concurrency/with_lock.h"
 #include "mongo/util/hierarchical_acquisition.h"
+#include "mongo/util/with_alignment.h"
 
 namespace mongo {
 
@@ -49,6 +51,10 @@ class ObservableSession;
 
 /**
  * Keeps track of the transaction runtime state for every active session on this instance.
+ *
+ * The sessions are partitioned into a fixed number of stripes by the hash of their logical session
+ * id, each with its own mutex, so that check-out and check-in of unrelated sessions do not contend
+ * with each other.
  */
 class SessionCatalog {
     SessionCatalog(const SessionCatalog&) = delete;
@@ -91,13 +97,13 @@ public:
     SessionToKill checkOutSessionForKill(OperationContext* opCtx, KillToken killToken);
 
     /**
-     * Iterates through the SessionCatalog under the SessionCatalog mutex and applies 'workerFn' to
-     * each Session which matches the specified 'matcher'.
+     * Iterates through the SessionCatalog and applies 'workerFn' to each Session which matches the
+     * specified 'matcher'. The stripes of the catalog are visited in order and each one is locked
+     * only while its own sessions are being visited, so the scan does not observe a single
+     * point-in-time view of the whole catalog.
      *
-     * NOTE: Since this method runs with the session catalog mutex, the work done by 'workerFn' is
-     * not allowed to block, perform I/O or acquire any lock manager locks.
-     * Iterates through the SessionCatalog and applies 'workerFn' to each Session. This locks the
-     * SessionCatalog.
+     * NOTE: Since 'workerFn' runs with the mutex of the stripe owning the session, the work it does
+     * is not allowed to block, perform I/O or acquire any lock manager locks.
      */
     using ScanSessionsCallbackFn = std::function<void(ObservableSession&)>;
     void scanSession(const LogicalSessionId& lsid, const ScanSessionsCallbackFn& workerFn);
@@ -105,7 +111,7 @@ public:
                       const ScanSessionsCallbackFn& workerFn);
 
     /**
-     * Shortcut to invoke 'kill' on the specified session under the SessionCatalog mutex. Throws a
+     * Shortcut to invoke 'kill' on the specified session under the mutex of its stripe. Throws a
      * NoSuchSession exception if the session doesn't exist.
      */
     KillToken killSession(const LogicalSessionId& lsid);
@@ -129,22 +135,45 @@ private:
         // sessions entries from the map.
         int numWaitingToCheckOut{0};
 
-        // Signaled when the state becomes available. Uses the transaction table's mutex to protect
+        // Signaled when the state becomes available. Uses the mutex of the owning stripe to protect
         // the state transitions.
         stdx::condition_variable availableCondVar;
     };
     using SessionRuntimeInfoMap = LogicalSessionIdMap<std::unique_ptr<SessionRuntimeInfo>>;
 
+    /**
+     * One partition of the catalog, owning the sessions whose ids hash to it.
+     */
+    struct Stripe {
+        // Protects the state below and the check-out state of the sessions owned by this stripe
+        mutable Mutex mutex =
+            MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(0), "SessionCatalog::Stripe::mutex");
+
+        // Owns the Session objects for all current Sessions which belong to this stripe.
+        SessionRuntimeInfoMap sessions;
+    };
+
+    // Number of stripes into which the sessions are partitioned. A thread must never hold the
+    // mutexes of more than one stripe at a time.
+    static constexpr std::size_t kNumStripes = 16;
+
+    /**
+     * Returns the stripe which owns the session with id 'lsid'.
+     */
+    Stripe& _getStripe(const LogicalSessionId& lsid);
+
     /**
      * Blocking method, which checks-out the session set on 'opCtx'.
      */
     ScopedCheckedOutSession _checkOutSession(OperationContext* opCtx);
 
     /**
-     * Creates or returns the session runtime info for 'lsid' from the '_sessions' map. The returned
-     * pointer is guaranteed to be linked on the map for as long as the mutex is held.
+     * Creates or returns the session runtime info for 'lsid' from the sessions map of 'stripe',
+     * whose mutex must be held. The returned pointer is guaranteed to be linked on the map for as
+     * long as the mutex is held.
      */
     SessionRuntimeInfo* _getOrCreateSessionRuntimeInfo(WithLock,
+                                                       Stripe& stripe,
                                                        OperationContext* opCtx,
                                                        const LogicalSessionId& lsid);
 
@@ -153,12 +182,9 @@ private:
      */
     void _releaseSession(SessionRuntimeInfo* sri, boost::optional<KillToken> killToken);
 
-    // Protects the state below
-    mutable Mutex _mutex =
-        MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(0), "SessionCatalog::_mutex");
-
-    // Owns the Session objects for all current Sessions.
-    SessionRuntimeInfoMap _sessions;
+    // Partitions of the catalog, each aligned to its own cache line so that threads working on
+    // different stripes do not share cache lines for their mutexes.
+    std::array<CacheAligned<Stripe>, kNumStripes> _stripes;
 };
 
 /**
@@ -242,8 +268,8 @@ using SessionToKill = SessionCatalog::SessionToKill;
 /**
  * This type represents access to a session inside of a scanSessions loop.
  * If you have one of these, you're in a scanSessions callback context, and so
- * have locked the whole catalog and, if the observed session is bound to an operation context,
- * you hold that operation context's client's mutex, as well.
+ * have locked the catalog stripe which owns the session and, if the observed session is bound to
+ * an operation context, you hold that operation context's client's mutex, as well.
  */
 class ObservableSession {
 public:
@@ -266,6 +266,36 @@ TEST_F(SessionCatalogTestWithDefaultOpCtx, ScanSessionsMarkForReap) {
     });
 }
 
+TEST_F(SessionCatalogTest, SizeAndScanSessionsCoverSessionsFromAllStripes) {
+    // Create enough sessions so that every stripe of the catalog is very likely to own some.
+    std::vector<LogicalSessionId> lsids;
+    for (int i = 0; i < 100; ++i) {
+        lsids.push_back(makeLogicalSessionIdForTest());
+
+        auto opCtx = makeOperationContext();
+        opCtx->setLogicalSessionId(lsids.back());
+        OperationContextSession ocs(opCtx.get());
+    }
+    ASSERT_EQ(lsids.size(), catalog()->size());
+
+    auto opCtx = makeOperationContext();
+    SessionKiller::Matcher matcherAllSessions(
+        KillAllSessionsByPatternSet{makeKillAllSessionsByPattern(opCtx.get())});
+
+    LogicalSessionIdSet lsidsFound;
+    catalog()->scanSessions(matcherAllSessions, [&](const ObservableSession& session) {
+        ASSERT(lsidsFound.insert(session.getSessionId()).second);
+    });
+    ASSERT_EQ(lsids.size(), lsidsFound.size());
+    for (const auto& lsid : lsids) {
+        ASSERT_EQ(1U, lsidsFound.count(lsid));
+    }
+
+    catalog()->scanSessions(matcherAllSessions,
+                            [](ObservableSession& session) { session.markForReap(); });
+    ASSERT_EQ(0U, catalog()->size());
+}
+
 TEST_F(SessionCatalogTest, KillSessionWhenSessionIsNotCheckedOut) {
     const auto lsid = makeLogicalSessionIdForTest();
 
@@ -94,12 +94,16 @@ std::unique_ptr<mongo::RecordStore> KVEngine::getRecordStore(OperationContext* o
 }
 
 bool KVEngine::trySwapMaster(StringStore& newMaster, uint64_t version) {
-    stdx::lock_guard<Latch> lock(_masterLock);
-    invariant(!newMaster.hasBranch() && !_master.hasBranch());
-    if (_masterVersion != version)
-        return false;
-    _master = newMaster;
-    _masterVersion++;
+    invariant(!newMaster.hasBranch());
+    auto snapshot = std::make_shared<const StringStore>(newMaster);
+    {
+        stdx::lock_guard<Latch> lock(_masterLock);
+        if (_masterVersion != version)
+            return false;
+        _master.swap(snapshot);
+        _masterVersion++;
+    }
+    // The previous master, now held by 'snapshot', is released outside of the lock.
     return true;
 }
 
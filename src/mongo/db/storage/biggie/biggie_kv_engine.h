@@ -144,16 +144,25 @@ public:
     // Biggie Specific
 
     /**
-     * Returns a pair of the current version and copy of tree of the master.
+     * Returns a pair of the current version and copy of tree of the master. The published master
+     * is immutable, so only the snapshot pointer is read under the lock and the copy is made
+     * outside of it.
      */
     std::pair<uint64_t, StringStore> getMasterInfo() {
-        stdx::lock_guard<Latch> lock(_masterLock);
-        return std::make_pair(_masterVersion, _master);
+        std::shared_ptr<const StringStore> master;
+        uint64_t version;
+        {
+            stdx::lock_guard<Latch> lock(_masterLock);
+            master = _master;
+            version = _masterVersion;
+        }
+        return std::make_pair(version, StringStore(*master));
     }
 
     /**
      * Returns true and swaps _master to newMaster if the version passed in is the same as the
-     * masters current version.
+     * masters current version. Only the version check and the pointer exchange happen under the
+     * lock, so concurrent committers serialize on a pointer swap rather than a tree copy.
      */
     bool trySwapMaster(StringStore& newMaster, uint64_t version);
 
@@ -169,7 +178,7 @@ private:
     std::unique_ptr<VisibilityManager> _visibilityManager;
 
     mutable Mutex _masterLock = MONGO_MAKE_LATCH("KVEngine::_masterLock");
-    StringStore _master;
+    std::shared_ptr<const StringStore> _master = std::make_shared<const StringStore>();
     uint64_t _masterVersion = 0;
 };
 }  // namespace biggie
@@ -72,6 +72,30 @@ public:
                          std::forward<WorkFuncs>(funcs)...);
     }
 
+    /**
+     * Runs the same work function on every thread. The function is additionally passed the index
+     * of the thread it runs on, so that threads can work on different keys.
+     */
+    template <class WorkFunc>
+    void initAllThreads(WorkFunc func) {
+        initAllThreadsImpl_(std::make_index_sequence<NumThreads>{}, std::move(func));
+    }
+
+    /**
+     * Returns the number of commits made to the master tree, excluding the setup.
+     */
+    std::size_t numCommits() const {
+        stdx::lock_guard lock(_mutex);
+        return _executionOrder.size();
+    }
+
+    /**
+     * Returns the number of merges that failed with a merge conflict and had to be retried.
+     */
+    std::uint64_t numMergeConflicts() const {
+        return _mergeConflicts.load();
+    }
+
     template <class Rep, class Period>
     StringStore runThreads(stdx::chrono::duration<Rep, Period> dur) {
         _barrier.count_down_and_wait();
@@ -145,6 +169,7 @@ private:
                         copy.merge3(base, head);
                     } catch (const merge_conflict_exception&) {
                         // Retry this operation in case of merge conflict
+                        _thisTest._mergeConflicts.fetchAndAdd(1);
                         committed = false;
                         break;
                     }
@@ -168,6 +193,22 @@ private:
     template <class WorkFunc>
     friend class Worker;
 
+    // Binds the index of the thread it runs on to a work function shared by all threads.
+    template <class WorkFunc>
+    struct IndexedWorkFunc {
+        bool operator()(StringStore& tree, std::size_t term) const {
+            return func(tree, index, term);
+        }
+
+        WorkFunc func;
+        std::size_t index;
+    };
+
+    template <std::size_t... Is, class WorkFunc>
+    void initAllThreadsImpl_(std::index_sequence<Is...>, WorkFunc func) {
+        initThreadsImpl_(std::index_sequence<Is...>{}, IndexedWorkFunc<WorkFunc>{func, Is}...);
+    }
+
     template <std::size_t... Is, class... WorkFuncs>
     void initThreadsImpl_(std::index_sequence<Is...>, const WorkFuncs&... funcs) {
         // Index sequence as a helper type to retrieve indexes for the WorkFuncs while expanding the
@@ -219,6 +260,7 @@ private:
     std::array<stdx::thread, NumThreads> _threads;
     boost::barrier _barrier{NumThreads + 1};
     AtomicWord<bool> _stop{false};
+    AtomicWord<std::uint64_t> _mergeConflicts{0};
 
     std::vector<int> _executionOrder;
     std::function<void(StringStore&)> _setupFunc;
@@ -228,6 +270,7 @@ private:
 // Helper to be be able to create a fixture with template parameters
 class ConcurrentRadixStoreTestFourThreads : public ConcurrentRadixStoreTest<4> {};
 class ConcurrentRadixStoreTestNineThreads : public ConcurrentRadixStoreTest<9> {};
+class ConcurrentRadixStoreTestSixtyFourThreads : public ConcurrentRadixStoreTest<64> {};
 
 TEST_F(ConcurrentRadixStoreTestFourThreads, UpdateDifferentKeysDifferentBranches) {
     setup([](StringStore& tree) {
@@ -408,5 +451,51 @@ TEST_F(ConcurrentRadixStoreTestNineThreads, InsertEraseUpdateSameBranch) {
     }
 }
 
+TEST_F(ConcurrentRadixStoreTestSixtyFourThreads, InsertDifferentKeysSharedPrefixThroughput) {
+    initAllThreads([](StringStore& tree, std::size_t index, std::size_t term) {
+        auto key = "prefix/" + std::to_string(index) + "/" + std::to_string(term);
+        return tree.insert({key, "a"}).second;
+    });
+
+    const auto duration = stdx::chrono::seconds(3);
+    auto result = runThreads(duration);
+
+    LOGV2(4785801,
+          "Concurrent radix store insert throughput",
+          "writers"_attr = 64,
+          "commits"_attr = numCommits(),
+          "mergeConflicts"_attr = numMergeConflicts(),
+          "commitsPerSecond"_attr = numCommits() / duration.count());
+
+    // Writers never touch the same key, so sharing a prefix must not cause merge conflicts.
+    ASSERT_EQ(numMergeConflicts(), 0U);
+    ASSERT_EQ(result.size(), numCommits());
+}
+
+TEST_F(ConcurrentRadixStoreTestSixtyFourThreads, UpdateDifferentKeysSharedPrefixThroughput) {
+    setup([](StringStore& tree) {
+        for (std::size_t index = 0; index < 64; ++index) {
+            tree.insert({"prefix/" + std::to_string(index), ""});
+        }
+    });
+
+    initAllThreads([](StringStore& tree, std::size_t index, std::size_t term) {
+        return tree.update({"prefix/" + std::to_string(index), std::string(term + 1, 'a')}).second;
+    });
+
+    const auto duration = stdx::chrono::seconds(3);
+    auto result = runThreads(duration);
+
+    LOGV2(4785802,
+          "Concurrent radix store update throughput",
+          "writers"_attr = 64,
+          "commits"_attr = numCommits(),
+          "mergeConflicts"_attr = numMergeConflicts(),
+          "commitsPerSecond"_attr = numCommits() / duration.count());
+
+    ASSERT_EQ(numMergeConflicts(), 0U);
+    ASSERT_EQ(result.size(), 64U);
+}
+
 }  // namespace biggie
 }  // namespace mongo
@@ -29,7 +29,7 @@
 
 #pragma once
 
-#include <array>
+#include <algorithm>
 #include <boost/optional.hpp>
 #include <cstring>
 #include <exception>
@@ -54,6 +54,10 @@ class merge_conflict_exception : std::exception {
  * minimize data duplication. Each node has a notion of ownership and if modifications are made to
  * non-uniquely owned nodes, they are copied to prevent dirtying the data for the other owners of
  * the node.
+ *
+ * Keys are path compressed, and every node stores its children in one of several layouts sized to
+ * the number of children it has (see NodeType), so sparse trees do not pay for a full 256 entry
+ * child array per node.
  */
 template <class Key, class T>
 class RadixStore {
@@ -191,25 +195,19 @@ public:
 
                 // Check the children right of the node that the iterator was at already. This way,
                 // there will be no backtracking in the traversal.
-                for (auto iter = oldKey + 1 + node->_children.begin();
-                     iter != node->_children.end();
-                     ++iter) {
-
-                    // If the node has a child, then the sub-tree must have a node with data that
-                    // has not yet been visited.
-                    if (*iter != nullptr) {
-
-                        // If the current node has data, return it and exit. If not, continue
-                        // following the nodes to find the next one with data. It is necessary to go
-                        // to the left-most node in this sub-tree.
-                        if ((*iter)->_data) {
-                            _current = iter->get();
-                            return;
-                        }
-                        _current = iter->get();
+                //
+                // If the node has such a child, then the sub-tree must have a node with data that
+                // has not yet been visited.
+                if (Node* child = node->firstChild(oldKey + 1)) {
+
+                    // If the current node has data, return it and exit. If not, continue
+                    // following the nodes to find the next one with data. It is necessary to go
+                    // to the left-most node in this sub-tree.
+                    _current = child;
+                    if (!child->_data) {
                         _traverseLeftSubtree();
-                        return;
                     }
+                    return;
                 }
             }
             return;
@@ -220,12 +218,7 @@ public:
             // '_current' is root. However, it cannot return the root, and hence at least 1
             // iteration of the while loop is required.
             do {
-                for (auto child : _current->_children) {
-                    if (child != nullptr) {
-                        _current = child.get();
-                        break;
-                    }
-                }
+                _current = _current->firstChild();
             } while (!_current->_data);
         }
 
@@ -399,14 +392,12 @@ public:
 
                 // After moving up in the tree, continue searching for neighboring nodes to see if
                 // they have data, moving from right to left.
-                for (int i = oldKey - 1; i >= 0; i--) {
-                    if (node->_children[i] != nullptr) {
-                        // If there is a sub-tree found, it must have data, therefore it's necessary
-                        // to traverse to the right most node.
-                        _current = node->_children[i].get();
-                        _traverseRightSubtree();
-                        return;
-                    }
+                if (Node* child = node->lastChild(oldKey)) {
+                    // If there is a sub-tree found, it must have data, therefore it's necessary
+                    // to traverse to the right most node.
+                    _current = child;
+                    _traverseRightSubtree();
+                    return;
                 }
 
                 // If there were no sub-trees that contained data, and the 'current' node has data,
@@ -421,15 +412,9 @@ public:
         void _traverseRightSubtree() {
             // This function traverses the given tree to the right most leaf of the subtree where
             // 'current' is the root.
-            do {
-                for (auto iter = _current->_children.rbegin(); iter != _current->_children.rend();
-                     ++iter) {
-                    if (*iter != nullptr) {
-                        _current = iter->get();
-                        break;
-                    }
-                }
-            } while (!_current->isLeaf());
+            while (!_current->isLeaf()) {
+                _current = _current->lastChild();
+            }
         }
 
         void updateTreeView(bool stopIfMultipleCursors = false) {
@@ -559,7 +544,7 @@ public:
         size_t depth = prev->_depth + prev->_trieKey.size();
         while (depth < key.size()) {
             uint8_t c = charKey[depth];
-            node = prev->_children[c].get();
+            node = prev->getChild(c);
             if (node == nullptr) {
                 return false;
             }
@@ -570,7 +555,7 @@ public:
                 return false;
             }
 
-            isUniquelyOwned = isUniquelyOwned && prev->_children[c].use_count() == 1;
+            isUniquelyOwned = isUniquelyOwned && prev->getSharedChild(c).use_count() == 1;
             context.push_back(std::make_pair(node, isUniquelyOwned));
             depth = node->_depth + node->_trieKey.size();
             prev = node;
@@ -615,16 +600,16 @@ public:
 
             uint8_t childFirstChar = child->_trieKey.front();
             if (!isUniquelyOwned) {
-                parent->_children[childFirstChar] = std::make_shared<Node>(*child);
-                child = parent->_children[childFirstChar].get();
+                auto childCopy = std::make_shared<Node>(*child);
+                child = childCopy.get();
+                parent->setChild(childFirstChar, std::move(childCopy));
             }
 
             parent = child;
         }
 
         // Handle the deleted node, as it is a leaf.
-        parent->_children[deleted->_trieKey.front()] = nullptr;
-        --parent->_numChildren;
+        parent->removeChild(deleted->_trieKey.front());
 
         // 'parent' may only have one child, in which case we need to evaluate whether or not
         // this node is redundant.
@@ -694,10 +679,11 @@ public:
             if (idx != UINT8_MAX)
                 context.push_back(std::make_pair(node, idx + 1));
 
-            if (!node->_children[idx])
+            Node* child = node->getChild(idx);
+            if (!child)
                 break;
 
-            node = node->_children[idx].get();
+            node = child;
             size_t mismatchIdx =
                 _comparePrefix(node->_trieKey, charKey + depth, key.size() - depth);
 
@@ -740,18 +726,14 @@ public:
             std::tie(node, idx) = context.back();
             context.pop_back();
 
-            for (auto iter = idx + node->_children.begin(); iter != node->_children.end(); ++iter) {
-                if (!(*iter))
-                    continue;
-
+            if (Node* child = node->firstChild(idx)) {
                 // There exists a node with a key larger than the one given.
-                node = iter->get();
+                node = child;
                 if (node->_data)
                     return const_iterator(_root, node);
 
                 // Need to search this node's children for the next largest node.
                 context.push_back(std::make_pair(node, 0));
-                break;
             }
 
             if (node->_trieKey.empty() && context.empty()) {
@@ -789,6 +771,13 @@ public:
     }
 
 private:
+    /**
+     * The child storage layout used by a node, chosen adaptively from the number of children in
+     * the style of an Adaptive Radix Tree. Smaller layouts use a fraction of the memory of a full
+     * 256 entry array, which dominates the size of sparse trees.
+     */
+    enum class NodeType : uint8_t { LEAF, NODE4, NODE16, NODE48, NODE256 };
+
     class Node {
         friend class RadixStore;
         friend class RadixStoreTest;
@@ -804,14 +793,15 @@ private:
             _depth = other._depth;
             if (other._data)
                 _data.emplace(other._data->first, other._data->second);
-            _children = other._children;
-            _numChildren = other._numChildren;
+            _copyChildren(other);
         }
 
         Node(Node&& other) {
             _depth = std::move(other._depth);
             _trieKey = std::move(other._trieKey);
             _data = std::move(other._data);
+            _nodeType = other._nodeType;
+            _childKeys = std::move(other._childKeys);
             _children = std::move(other._children);
             _numChildren = std::move(other._numChildren);
         }
@@ -826,11 +816,294 @@ private:
             return _numChildren;
         }
 
+        NodeType nodeType() const {
+            return _nodeType;
+        }
+
+        /**
+         * Returns the child whose trie key starts with 'key', or nullptr if there is none.
+         */
+        Node* getChild(uint8_t key) const {
+            int slot = _findSlot(key);
+            return slot < 0 ? nullptr : _children[slot].get();
+        }
+
+        /**
+         * Returns a reference to the owning pointer of the child whose trie key starts with 'key',
+         * or to a null pointer if there is none. The reference is invalidated by any change to the
+         * children of this node.
+         */
+        const std::shared_ptr<Node>& getSharedChild(uint8_t key) const {
+            static const std::shared_ptr<Node> kNoChild;
+            int slot = _findSlot(key);
+            return slot < 0 ? kNoChild : _children[slot];
+        }
+
+        /**
+         * Returns the child with the smallest key that is at least 'from', or nullptr if there is
+         * none. 'from' may be 256, in which case nullptr is returned.
+         */
+        Node* firstChild(unsigned from = 0) const {
+            switch (_nodeType) {
+                case NodeType::LEAF:
+                    return nullptr;
+                case NodeType::NODE4:
+                case NodeType::NODE16:
+                    for (size_t i = 0; i < _childKeys.size(); ++i) {
+                        if (_childKeys[i] >= from)
+                            return _children[i].get();
+                    }
+                    return nullptr;
+                case NodeType::NODE48:
+                    for (unsigned key = from; key < 256; ++key) {
+                        if (_childKeys[key])
+                            return _children[_childKeys[key] - 1].get();
+                    }
+                    return nullptr;
+                case NodeType::NODE256:
+                    for (unsigned key = from; key < 256; ++key) {
+                        if (_children[key])
+                            return _children[key].get();
+                    }
+                    return nullptr;
+            }
+            MONGO_UNREACHABLE;
+        }
+
+        /**
+         * Returns the child with the largest key that is less than 'before', or nullptr if there is
+         * none.
+         */
+        Node* lastChild(unsigned before = 256) const {
+            switch (_nodeType) {
+                case NodeType::LEAF:
+                    return nullptr;
+                case NodeType::NODE4:
+                case NodeType::NODE16:
+                    for (size_t i = _childKeys.size(); i > 0; --i) {
+                        if (_childKeys[i - 1] < before)
+                            return _children[i - 1].get();
+                    }
+                    return nullptr;
+                case NodeType::NODE48:
+                    for (unsigned key = before; key > 0; --key) {
+                        if (_childKeys[key - 1])
+                            return _children[_childKeys[key - 1] - 1].get();
+                    }
+                    return nullptr;
+                case NodeType::NODE256:
+                    for (unsigned key = before; key > 0; --key) {
+                        if (_children[key - 1])
+                            return _children[key - 1].get();
+                    }
+                    return nullptr;
+            }
+            MONGO_UNREACHABLE;
+        }
+
+        /**
+         * Sets the child for 'key' to 'child', replacing any existing child for that key, and
+         * grows the node into a larger layout if needed. A null 'child' removes the existing one.
+         */
+        void setChild(uint8_t key, std::shared_ptr<Node> child) {
+            if (!child) {
+                removeChild(key);
+                return;
+            }
+
+            int slot = _findSlot(key);
+            if (slot >= 0) {
+                _children[slot] = std::move(child);
+                return;
+            }
+
+            if (_numChildren == _capacity(_nodeType))
+                _changeType(_growType(_nodeType));
+
+            switch (_nodeType) {
+                case NodeType::LEAF:
+                    MONGO_UNREACHABLE;
+                case NodeType::NODE4:
+                case NodeType::NODE16: {
+                    auto pos = std::lower_bound(_childKeys.begin(), _childKeys.end(), key);
+                    _children.insert(_children.begin() + (pos - _childKeys.begin()),
+                                     std::move(child));
+                    _childKeys.insert(pos, key);
+                    break;
+                }
+                case NodeType::NODE48: {
+                    // Reuse a slot freed by an earlier removal before appending a new one.
+                    auto freeSlot = std::find(_children.begin(), _children.end(), nullptr);
+                    if (freeSlot == _children.end())
+                        freeSlot = _children.insert(freeSlot, nullptr);
+                    *freeSlot = std::move(child);
+                    _childKeys[key] = freeSlot - _children.begin() + 1;
+                    break;
+                }
+                case NodeType::NODE256:
+                    _children[key] = std::move(child);
+                    break;
+            }
+            ++_numChildren;
+        }
+
+        /**
+         * Removes the child for 'key' if there is one, and shrinks the node into a smaller layout
+         * once it has become sparse enough.
+         */
+        void removeChild(uint8_t key) {
+            int slot = _findSlot(key);
+            if (slot < 0)
+                return;
+
+            switch (_nodeType) {
+                case NodeType::LEAF:
+                    MONGO_UNREACHABLE;
+                case NodeType::NODE4:
+                case NodeType::NODE16:
+                    _childKeys.erase(_childKeys.begin() + slot);
+                    _children.erase(_children.begin() + slot);
+                    break;
+                case NodeType::NODE48:
+                    _childKeys[key] = 0;
+                    _children[slot] = nullptr;
+                    break;
+                case NodeType::NODE256:
+                    _children[slot] = nullptr;
+                    break;
+            }
+            --_numChildren;
+
+            // Shrink below the capacity of the smaller layout so that alternating insertions and
+            // removals at the boundary do not repeatedly convert the node.
+            if (_numChildren == 0) {
+                _changeType(NodeType::LEAF);
+            } else if (_nodeType != NodeType::NODE4 &&
+                       _numChildren < _capacity(_shrinkType(_nodeType)) * 3 / 4) {
+                _changeType(_shrinkType(_nodeType));
+            }
+        }
+
     protected:
         unsigned int _depth = 0;
         std::vector<uint8_t> _trieKey;
         boost::optional<value_type> _data;
-        std::array<std::shared_ptr<Node>, 256> _children;
+
+    private:
+        static uint16_t _capacity(NodeType type) {
+            switch (type) {
+                case NodeType::LEAF:
+                    return 0;
+                case NodeType::NODE4:
+                    return 4;
+                case NodeType::NODE16:
+                    return 16;
+                case NodeType::NODE48:
+                    return 48;
+                case NodeType::NODE256:
+                    return 256;
+            }
+            MONGO_UNREACHABLE;
+        }
+
+        static NodeType _growType(NodeType type) {
+            invariant(type != NodeType::NODE256);
+            return static_cast<NodeType>(static_cast<uint8_t>(type) + 1);
+        }
+
+        static NodeType _shrinkType(NodeType type) {
+            invariant(type != NodeType::LEAF);
+            return static_cast<NodeType>(static_cast<uint8_t>(type) - 1);
+        }
+
+        /**
+         * Returns the position in '_children' of the child for 'key', or -1 if there is none.
+         */
+        int _findSlot(uint8_t key) const {
+            switch (_nodeType) {
+                case NodeType::LEAF:
+                    return -1;
+                case NodeType::NODE4:
+                case NodeType::NODE16:
+                    for (size_t i = 0; i < _childKeys.size(); ++i) {
+                        if (_childKeys[i] == key)
+                            return i;
+                    }
+                    return -1;
+                case NodeType::NODE48:
+                    return static_cast<int>(_childKeys[key]) - 1;
+                case NodeType::NODE256:
+                    return _children[key] ? key : -1;
+            }
+            MONGO_UNREACHABLE;
+        }
+
+        /**
+         * Rebuilds the child storage in the layout for 'type', preserving all children.
+         */
+        void _changeType(NodeType type) {
+            std::vector<uint8_t> keys;
+            std::vector<std::shared_ptr<Node>> children;
+            switch (type) {
+                case NodeType::LEAF:
+                    break;
+                case NodeType::NODE4:
+                case NodeType::NODE16:
+                    keys.reserve(_capacity(type));
+                    children.reserve(_capacity(type));
+                    break;
+                case NodeType::NODE48:
+                    keys.resize(256);
+                    children.reserve(_capacity(type));
+                    break;
+                case NodeType::NODE256:
+                    children.resize(256);
+                    break;
+            }
+
+            for (unsigned key = 0; key < 256; ++key) {
+                int slot = _findSlot(key);
+                if (slot < 0)
+                    continue;
+
+                switch (type) {
+                    case NodeType::LEAF:
+                        MONGO_UNREACHABLE;
+                    case NodeType::NODE4:
+                    case NodeType::NODE16:
+                        keys.push_back(key);
+                        children.push_back(std::move(_children[slot]));
+                        break;
+                    case NodeType::NODE48:
+                        children.push_back(std::move(_children[slot]));
+                        keys[key] = children.size();
+                        break;
+                    case NodeType::NODE256:
+                        children[key] = std::move(_children[slot]);
+                        break;
+                }
+            }
+
+            _nodeType = type;
+            _childKeys = std::move(keys);
+            _children = std::move(children);
+        }
+
+        void _copyChildren(const Node& other) {
+            _nodeType = other._nodeType;
+            _childKeys = other._childKeys;
+            _children = other._children;
+            _numChildren = other._numChildren;
+        }
+
+        NodeType _nodeType = NodeType::LEAF;
+
+        // For NODE4 and NODE16, the first bytes of the children's trie keys in ascending order,
+        // parallel to '_children'. For NODE48, maps every byte to one plus the position of its
+        // child in '_children', or zero if there is no such child. Unused for NODE256, where
+        // '_children' is indexed directly by byte.
+        std::vector<uint8_t> _childKeys;
+        std::vector<std::shared_ptr<Node>> _children;
         // TODO SERVER-36709: Updating to uint8_t after using adaptive nodes.
         uint16_t _numChildren = 0;
     };
@@ -900,10 +1173,9 @@ private:
         }
         ret.push_back('\n');
 
-        for (auto child : node->_children) {
-            if (child != nullptr) {
-                ret.append(_walkTree(child.get(), depth + 1));
-            }
+        for (Node* child = node->firstChild(); child;
+             child = node->firstChild(child->_trieKey.front() + 1)) {
+            ret.append(_walkTree(child, depth + 1));
         }
         return ret;
     }
@@ -930,7 +1202,7 @@ private:
 
         depth = _root->_depth + _root->_trieKey.size();
         uint8_t childFirstChar = charKey[depth];
-        auto node = _root->_children[childFirstChar];
+        Node* node = _root->getChild(childFirstChar);
 
         while (node != nullptr) {
 
@@ -941,13 +1213,13 @@ private:
             if (mismatchIdx != node->_trieKey.size()) {
                 return nullptr;
             } else if (mismatchIdx == key.size() - depth && node->_data) {
-                return node.get();
+                return node;
             }
 
             depth = node->_depth + node->_trieKey.size();
 
             childFirstChar = charKey[depth];
-            node = node->_children[childFirstChar];
+            node = node->getChild(childFirstChar);
         }
 
         return nullptr;
@@ -999,12 +1271,12 @@ private:
         _makeRootUnique();
 
         Node* prev = _root.get();
-        std::shared_ptr<Node> node = prev->_children[childFirstChar];
+        std::shared_ptr<Node> node = prev->getSharedChild(childFirstChar);
         while (node != nullptr) {
             if (node.use_count() - 1 > 1) {
                 // Copy node on a modifying operation when it isn't owned uniquely.
                 node = std::make_shared<Node>(*node);
-                prev->_children[childFirstChar] = node;
+                prev->setChild(childFirstChar, node);
             }
 
             // 'node' is uniquely owned at this point, so we are free to modify it.
@@ -1037,8 +1309,7 @@ private:
 
                 // Change the current node's trieKey and make a child of the new node.
                 newKey = _makeKey(node->_trieKey, mismatchIdx, node->_trieKey.size() - mismatchIdx);
-                newNode->_children[newKey.front()] = node;
-                ++newNode->_numChildren;
+                newNode->setChild(newKey.front(), node);
 
                 node->_trieKey = newKey;
                 node->_depth = newNode->_depth + newNode->_trieKey.size();
@@ -1070,7 +1341,7 @@ private:
             childFirstChar = charKey[depth];
 
             prev = node.get();
-            node = node->_children[childFirstChar];
+            node = node->getSharedChild(childFirstChar);
         }
 
         // Add a completely new child to a node. The new key at this depth does not
@@ -1118,12 +1389,7 @@ private:
         if (value) {
             newNode->_data.emplace(value->first, value->second);
         }
-        auto& child = node->_children[key.front()];
-        if (!child) {
-            // Only increment the number of children if the node didn't have one at the position.
-            ++node->_numChildren;
-        }
-        child = newNode;
+        node->setChild(key.front(), newNode);
         return newNode.get();
     }
 
@@ -1144,7 +1410,7 @@ private:
 
         while (depth < key.size()) {
             uint8_t c = charKey[depth];
-            node = node->_children[c].get();
+            node = node->getChild(c);
             context.push_back(node);
             depth = node->_depth + node->_trieKey.size();
         }
@@ -1180,15 +1446,9 @@ private:
             return false;
         }
 
-        // Determine if this node has only one child.
-        std::shared_ptr<Node> onlyChild = nullptr;
-
-        for (size_t i = 0; i < node->_children.size(); ++i) {
-            if (node->_children[i] != nullptr) {
-                onlyChild = node->_children[i];
-                break;
-            }
-        }
+        // Keep the only child alive while its contents are moved into this node.
+        std::shared_ptr<Node> onlyChild =
+            node->getSharedChild(node->firstChild()->_trieKey.front());
 
         // Append the child's key onto the parent.
         for (char item : onlyChild->_trieKey) {
@@ -1198,8 +1458,7 @@ private:
         if (onlyChild->_data) {
             node->_data.emplace(onlyChild->_data->first, onlyChild->_data->second);
         }
-        node->_children = onlyChild->_children;
-        node->_numChildren = onlyChild->_numChildren;
+        node->_copyChildren(*onlyChild);
         return true;
     }
 
@@ -1213,7 +1472,7 @@ private:
         context[0] = replaceNode;
 
         for (size_t node = 1; node < context.size(); node++) {
-            replaceNode = replaceNode->_children[trieKeyIndex[node - 1]].get();
+            replaceNode = replaceNode->getChild(trieKeyIndex[node - 1]);
             context[node] = replaceNode;
         }
     }
@@ -1238,13 +1497,13 @@ private:
         for (size_t idx = 1; idx < context.size(); idx++) {
             node = context[idx];
 
-            if (prev->_children[node->_trieKey.front()].use_count() > 1) {
+            if (prev->getSharedChild(node->_trieKey.front()).use_count() > 1) {
                 std::shared_ptr<Node> nodeCopy = std::make_shared<Node>(*node);
-                prev->_children[nodeCopy->_trieKey.front()] = nodeCopy;
+                prev->setChild(nodeCopy->_trieKey.front(), nodeCopy);
                 context[idx] = nodeCopy.get();
                 prev = nodeCopy.get();
             } else {
-                prev = prev->_children[node->_trieKey.front()].get();
+                prev = prev->getChild(node->_trieKey.front());
             }
         }
 
@@ -1377,8 +1636,8 @@ private:
             auto key = current->_trieKey.front();
             auto newTrieKeyBegin = current->_trieKey.begin();
             auto newTrieKeyEnd = current->_trieKey.begin() + mismatchIdx;
-            auto shared_current = std::move(parent->_children[key]);
-            --parent->_numChildren;
+            auto shared_current = parent->getSharedChild(key);
+            parent->removeChild(key);
             auto newTrieKey = std::vector<uint8_t>(newTrieKeyBegin, newTrieKeyEnd);
 
             // Replace current with a new node with no data
@@ -1391,8 +1650,7 @@ private:
 
             // Add what was the current node as a child to the new internal node
             key = current->_trieKey.front();
-            newNode->_children[key] = std::move(shared_current);
-            newNode->_numChildren = 1;
+            newNode->setChild(key, std::move(shared_current));
 
             // Update current pointer and context
             child = current;
@@ -1406,9 +1664,9 @@ private:
             // Since _makeBranchUnique may make changes to the pointer addresses in recursive calls.
             current = context.back();
 
-            Node* node = current->_children[key].get();
-            Node* baseNode = base->_children[key].get();
-            Node* otherNode = other->_children[key].get();
+            Node* node = current->getChild(key);
+            Node* baseNode = base->getChild(key);
+            Node* otherNode = other->getChild(key);
 
             if (!node && !baseNode && !otherNode)
                 continue;
@@ -1427,13 +1685,25 @@ private:
                     // modifications that go on in _makeBranchUnique.
                     _rebuildContext(context, trieKeyIndex);
 
-                    current->_children[key] = other->_children[key];
-                    ++current->_numChildren;
-                } else if (!otherNode || (baseNode && baseNode != otherNode)) {
-                    // Either the master tree and working tree remove the same branch, or the master
-                    // tree updated the branch while the working tree removed the branch, resulting
-                    // in a merge conflict.
+                    current->setChild(key, other->getSharedChild(key));
+                } else if (!otherNode) {
+                    // The master tree and working tree both removed the same branch, resulting in
+                    // a merge conflict.
                     throw merge_conflict_exception();
+                } else if (baseNode != otherNode) {
+                    // The master tree updated the branch while the working tree removed it. This is
+                    // only a conflict if the master tree changed one of the removed keys, so
+                    // resolve the differences element by element.
+                    if (currentHasBeenCompressed()) {
+                        resolveConflictNeeded = true;
+                        break;
+                    }
+
+                    Node emptyNode;
+                    _mergeResolveConflict(&emptyNode, baseNode, otherNode);
+                    _rebuildContext(context, trieKeyIndex);
+                    if (!context.back())
+                        break;
                 }
             } else if (!unique) {
                 if (baseNode && !otherNode && baseNode == node) {
@@ -1443,22 +1713,31 @@ private:
 
                     current = _makeBranchUnique(context);
                     _rebuildContext(context, trieKeyIndex);
-                    current->_children[key] = nullptr;
-                    --current->_numChildren;
+                    current->removeChild(key);
                 } else if (baseNode && otherNode && baseNode == node) {
                     node = splitCurrentBeforeWriteIfNeeded(node);
 
                     // If base and current point to the same node, then master changed.
                     current = _makeBranchUnique(context);
                     _rebuildContext(context, trieKeyIndex);
-                    current->_children[key] = other->_children[key];
+                    current->setChild(key, other->getSharedChild(key));
                 }
             } else if (baseNode && otherNode && baseNode != otherNode) {
-                // If all three are unique and leaf nodes with different data, then it is a merge
-                // conflict.
+                // If all three are unique leaf nodes, it is only a merge conflict when both trees
+                // changed the data. A leaf may be a fresh copy with unchanged data, e.g. after an
+                // earlier element-wise resolution rebuilt it.
                 if (node->isLeaf() && baseNode->isLeaf() && otherNode->isLeaf()) {
-                    if (node->_data != baseNode->_data || baseNode->_data != otherNode->_data)
+                    bool dataChanged = node->_data != baseNode->_data;
+                    bool otherDataChanged = baseNode->_data != otherNode->_data;
+                    if (dataChanged && otherDataChanged)
                         throw merge_conflict_exception();
+                    if (otherDataChanged) {
+                        // Only the master tree changed the data, so take its node.
+                        splitCurrentBeforeWriteIfNeeded(node);
+                        current = _makeBranchUnique(context);
+                        _rebuildContext(context, trieKeyIndex);
+                        current->setChild(key, other->getSharedChild(key));
+                    }
                     continue;
                 }
 
@@ -1483,8 +1762,7 @@ private:
                         // Drop if leaf node without data, that is not valid. Otherwise we might
                         // need to compress if we have only one child.
                         if (node->isLeaf()) {
-                            current->_children[key] = nullptr;
-                            --current->_numChildren;
+                            current->removeChild(key);
                         } else {
                             _compressOnlyChild(node);
                         }
@@ -1500,9 +1778,19 @@ private:
                         break;
                 }
             } else if (baseNode && !otherNode) {
-                // Throw a write conflict since current has modified a branch but master has
-                // removed it.
-                throw merge_conflict_exception();
+                // The working tree modified a branch that the master tree removed. This is only a
+                // conflict if the working tree changed one of the removed keys, so resolve the
+                // differences element by element.
+                if (currentHasBeenCompressed()) {
+                    resolveConflictNeeded = true;
+                    break;
+                }
+
+                Node emptyNode;
+                _mergeResolveConflict(node, baseNode, &emptyNode);
+                _rebuildContext(context, trieKeyIndex);
+                if (!context.back())
+                    break;
             } else if (!baseNode && otherNode) {
                 // Both the working tree and master added branches that were nonexistent in base.
                 // This requires us to resolve these differences element by element since the
@@ -1528,12 +1816,7 @@ private:
     Node* _begin(Node* root) const noexcept {
         Node* node = root;
         while (!node->_data) {
-            for (auto child : node->_children) {
-                if (child != nullptr) {
-                    node = child.get();
-                    break;
-                }
-            }
+            node = node->firstChild();
         }
         return node;
     }
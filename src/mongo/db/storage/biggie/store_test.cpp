@@ -27,6 +27,7 @@
  *    it in the license file.
  */
 
+#include <algorithm>
 #include <deque>
 
 #include "mongo/platform/basic.h"
@@ -42,6 +43,7 @@ using value_type = StringStore::value_type;
 class RadixStoreTest : public unittest::Test {
 public:
     using node_type = StringStore::Node;
+    using node_type_enum = StringStore::NodeType;
 
     virtual ~RadixStoreTest() {
         checkValid(thisStore);
@@ -87,7 +89,7 @@ public:
         while (!level.empty()) {
             auto node = level.front().get();
             for (int i = 0; i < 256; ++i) {
-                auto child = node->_children[i];
+                auto child = node->getSharedChild(i);
                 if (child.get()) {
                     level.push_back(child);
                     result.push_back(child);
@@ -99,20 +101,35 @@ public:
     }
 
     /**
-     * Checks if the number of children and _numChildren are equal in each node of the 'store'.
+     * Checks if the number of children and _numChildren are equal in each node of the 'store', and
+     * that every node uses a child layout large enough for its children.
      */
     void checkNumChildrenValid(StringStore& store) const {
         auto nodes = allNodes(store);
         for (const auto& node : nodes) {
             uint16_t numChildren = 0;
-            auto children = node.get()->_children;
-            for (uint16_t i = 0; i < children.size(); ++i) {
-                if (children[i]) {
+            for (int i = 0; i < 256; ++i) {
+                if (node->getChild(i)) {
+                    ASSERT_EQ(node->getChild(i)->_trieKey.front(), i);
                     ++numChildren;
                 }
             }
-            ASSERT_EQ(numChildren, node.get()->numChildren());
+            ASSERT_EQ(numChildren, node->numChildren());
+            ASSERT_LTE(numChildren, node_type::_capacity(node->nodeType()));
+            ASSERT_EQ(numChildren == 0, node->nodeType() == node_type_enum::LEAF);
+        }
+    }
+
+    /**
+     * Returns the node for the key 'prefix' in 'store'.
+     */
+    node_type* getNode(StringStore& store, const std::string& prefix) const {
+        for (const auto& node : allNodes(store)) {
+            if (node->_data && node->_data->first == prefix) {
+                return node.get();
+            }
         }
+        return nullptr;
     }
 
 protected:
@@ -1894,6 +1911,86 @@ TEST_F(RadixStoreTest, MergeConflictingInsertions) {
     ASSERT_THROWS(thisStore.merge3(baseStore, otherStore), merge_conflict_exception);
 }
 
+TEST_F(RadixStoreTest, MergeDeletionThisAndInsertionOtherUnderSharedPrefix) {
+    baseStore.insert({"a/x", "1"});
+
+    thisStore = baseStore;
+    otherStore = baseStore;
+
+    // Removing the only key under the prefix removes the whole branch from the working tree, while
+    // the master tree adds an unrelated key to the same branch.
+    thisStore.erase("a/x");
+    otherStore.insert({"a/y", "2"});
+
+    expected.insert({"a/y", "2"});
+
+    thisStore.merge3(baseStore, otherStore);
+    ASSERT_TRUE(thisStore == expected);
+}
+
+TEST_F(RadixStoreTest, MergeInsertionThisAndDeletionOtherUnderSharedPrefix) {
+    baseStore.insert({"a/x", "1"});
+
+    thisStore = baseStore;
+    otherStore = baseStore;
+
+    thisStore.insert({"a/y", "2"});
+    otherStore.erase("a/x");
+
+    expected.insert({"a/y", "2"});
+
+    thisStore.merge3(baseStore, otherStore);
+    ASSERT_TRUE(thisStore == expected);
+}
+
+TEST_F(RadixStoreTest, MergeUnchangedCopyThisAndModificationOther) {
+    baseStore.insert({"a/x", "1"});
+    baseStore.insert({"a/y", "2"});
+
+    thisStore = baseStore;
+    otherStore = baseStore;
+
+    // Writing back the original value leaves the working tree with a copy of the leaf that holds
+    // the same data as base, which must not conflict with a change in the master tree.
+    thisStore.update({"a/x", "3"});
+    thisStore.update({"a/x", "1"});
+    otherStore.update({"a/x", "4"});
+
+    expected.insert({"a/x", "4"});
+    expected.insert({"a/y", "2"});
+
+    thisStore.merge3(baseStore, otherStore);
+    ASSERT_TRUE(thisStore == expected);
+}
+
+TEST_F(RadixStoreTest, MergeConflictingDeletionThisAndModificationOtherUnderSharedPrefix) {
+    baseStore.insert({"a/x", "1"});
+
+    thisStore = baseStore;
+    otherStore = baseStore;
+
+    thisStore.erase("a/x");
+    otherStore.insert({"a/y", "2"});
+    otherStore.update({"a/x", "3"});
+
+    ASSERT_THROWS(thisStore.merge3(baseStore, otherStore), merge_conflict_exception);
+}
+
+TEST_F(RadixStoreTest, MergeConflictingModificationThisAndDeletionOtherUnderSharedPrefix) {
+    baseStore.insert({"a/x", "1"});
+    baseStore.insert({"a/y", "1"});
+
+    thisStore = baseStore;
+    otherStore = baseStore;
+
+    thisStore.update({"a/x", "2"});
+    thisStore.insert({"a/z", "2"});
+    otherStore.erase("a/x");
+    otherStore.erase("a/y");
+
+    ASSERT_THROWS(thisStore.merge3(baseStore, otherStore), merge_conflict_exception);
+}
+
 TEST_F(RadixStoreTest, MergeDifferentLeafNodesSameDataTest) {
     baseStore.insert({"a", "a"});
     baseStore.insert({"aa", "a"});
@@ -2770,5 +2867,110 @@ TEST_F(RadixStoreTest, LowerBoundEndpoint) {
     ASSERT_TRUE(it == thisStore.end());
 }
 
+TEST_F(RadixStoreTest, AdaptiveNodeGrowsWithNumberOfChildren) {
+    thisStore.insert(value_type("a", "1"));
+    ASSERT_TRUE(getNode(thisStore, "a")->nodeType() == node_type_enum::LEAF);
+
+    for (int i = 0; i < 256; ++i) {
+        thisStore.insert(value_type(std::string("a") + static_cast<char>(i), "2"));
+
+        node_type* node = getNode(thisStore, "a");
+        ASSERT_EQ(node->numChildren(), i + 1);
+        if (i < 4) {
+            ASSERT_TRUE(node->nodeType() == node_type_enum::NODE4);
+        } else if (i < 16) {
+            ASSERT_TRUE(node->nodeType() == node_type_enum::NODE16);
+        } else if (i < 48) {
+            ASSERT_TRUE(node->nodeType() == node_type_enum::NODE48);
+        } else {
+            ASSERT_TRUE(node->nodeType() == node_type_enum::NODE256);
+        }
+    }
+    ASSERT_EQ(thisStore.size(), StringStore::size_type(257));
+}
+
+TEST_F(RadixStoreTest, AdaptiveNodeShrinksAfterErase) {
+    thisStore.insert(value_type("a", "1"));
+    for (int i = 0; i < 256; ++i) {
+        thisStore.insert(value_type(std::string("a") + static_cast<char>(i), "2"));
+    }
+
+    for (int i = 255; i >= 0; --i) {
+        ASSERT_TRUE(thisStore.erase(std::string("a") + static_cast<char>(i)));
+    }
+
+    node_type* node = getNode(thisStore, "a");
+    ASSERT_TRUE(node->nodeType() == node_type_enum::LEAF);
+    ASSERT_EQ(thisStore.size(), StringStore::size_type(1));
+
+    // Erasing down to a handful of children leaves the node in its smallest layout.
+    for (int i = 0; i < 64; ++i) {
+        thisStore.insert(value_type(std::string("a") + static_cast<char>(i), "2"));
+    }
+    ASSERT_TRUE(getNode(thisStore, "a")->nodeType() == node_type_enum::NODE256);
+    for (int i = 0; i < 62; ++i) {
+        ASSERT_TRUE(thisStore.erase(std::string("a") + static_cast<char>(i)));
+    }
+    ASSERT_TRUE(getNode(thisStore, "a")->nodeType() == node_type_enum::NODE4);
+}
+
+TEST_F(RadixStoreTest, AdaptiveNodeIterationOrder) {
+    // Insert children out of order so that every node layout has to keep them sorted.
+    std::vector<std::string> keys;
+    for (int i = 0; i < 256; i += 3) {
+        keys.push_back(std::string("k") + static_cast<char>((i * 7) % 256));
+    }
+    for (const auto& key : keys) {
+        thisStore.insert(value_type(key, "1"));
+    }
+    std::sort(keys.begin(), keys.end());
+
+    auto it = thisStore.begin();
+    for (const auto& key : keys) {
+        ASSERT_TRUE(it != thisStore.end());
+        ASSERT_EQ(it->first, key);
+        ++it;
+    }
+    ASSERT_TRUE(it == thisStore.end());
+
+    auto rit = thisStore.rbegin();
+    for (auto key = keys.rbegin(); key != keys.rend(); ++key) {
+        ASSERT_TRUE(rit != thisStore.rend());
+        ASSERT_EQ(rit->first, *key);
+        ++rit;
+    }
+    ASSERT_TRUE(rit == thisStore.rend());
+
+    for (size_t i = 1; i < keys.size(); ++i) {
+        // A key between two neighbours has the larger neighbour as its lower bound.
+        ASSERT_EQ(thisStore.lower_bound(keys[i - 1] + "\x01")->first, keys[i]);
+    }
+}
+
+TEST_F(RadixStoreTest, AdaptiveNodeMergeAcrossLayouts) {
+    baseStore.insert(value_type("a", "1"));
+    for (int i = 0; i < 10; ++i) {
+        baseStore.insert(value_type(std::string("a") + static_cast<char>('a' + i), "1"));
+    }
+
+    thisStore = baseStore;
+    otherStore = baseStore;
+
+    // The working copy grows the shared node into a larger layout while the master tree adds and
+    // removes unrelated children.
+    for (int i = 10; i < 60; ++i) {
+        thisStore.insert(value_type(std::string("a") + static_cast<char>('a' + i), "2"));
+    }
+    otherStore.insert(value_type(std::string("a") + static_cast<char>('A'), "3"));
+    otherStore.erase(std::string("aa"));
+
+    expected = thisStore;
+    expected.insert(value_type(std::string("aA"), "3"));
+    expected.erase(std::string("aa"));
+
+    thisStore.merge3(baseStore, otherStore);
+    ASSERT_TRUE(thisStore == expected);
+}
+
 }  // namespace biggie
 }  // namespace mongo
@@ -43,6 +43,7 @@
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/server_options.h"
 #include "mongo/db/storage/flow_control_parameters_gen.h"
+#include "mongo/db/storage/kv/kv_engine.h"
 #include "mongo/logv2/log.h"
 #include "mongo/util/background.h"
 #include "mongo/util/fail_point.h"
@@ -56,6 +57,15 @@ MONGO_FAIL_POINT_DEFINE(flowControlTicketOverride);
 namespace {
 const auto getFlowControl = ServiceContext::declareDecoration<std::unique_ptr<FlowControl>>();
 
+// Gains of the cache pressure controller, applied to how far the combined cache pressure signal is
+// above its target.
+const double kCachePressureProportionalGain = 1.0;
+const double kCachePressureIntegralGain = 0.2;
+const double kCachePressureDerivativeGain = 0.2;
+
+// Bounds the accumulated error so that the controller recovers promptly once pressure subsides.
+const double kCachePressureMaxIntegral = 5.0;
+
 int multiplyWithOverflowCheck(double term1, double term2, int maxValue) {
     if (term1 == 0.0 || term2 == 0.0) {
         // Early return to avoid any divide by zero errors.
@@ -137,6 +147,7 @@ FlowControl::FlowControl(repl::ReplicationCoordinator* replCoord)
 
 FlowControl::FlowControl(ServiceContext* service, repl::ReplicationCoordinator* replCoord)
     : ServerStatusSection("flowControl"),
+      _service(service),
       _replCoord(replCoord),
       _lastTimeSustainerAdvanced(Date_t::now()) {
     // Initialize _lastTargetTicketsPermitted to maximum tickets to make sure flow control doesn't
@@ -213,6 +224,12 @@ BSONObj FlowControl::generateSection(OperationContext* opCtx,
     bob.append("isLagged", _isLagged.load());
     bob.append("isLaggedCount", _isLaggedCount.load());
     bob.append("isLaggedTimeMicros", _isLaggedTimeMicros.load());
+    bob.append("cachePressureEnabled", gFlowControlCachePressureEnabled.load());
+    // As with locksPerKiloOp, scale the pressure so it survives FTDC's integer storage.
+    bob.append("cachePressurePerMille", _lastCachePressure.load() * 1000);
+    bob.append("cachePressureRateLimit", _lastCachePressureTicketsPermitted.load());
+    bob.append("isCachePressured", _isCachePressured.load());
+    bob.append("isCachePressuredCount", _isCachePressuredCount.load());
 
     return bob.obj();
 }
@@ -318,6 +335,82 @@ int FlowControl::_calculateNewTicketsForLag(const std::vector<repl::MemberData>&
     return multiplyWithOverflowCheck(locksPerOp, sustainerAppliedPenalty, kMaxTickets);
 }
 
+int FlowControl::_calculateNewTicketsForCachePressure(const CachePressureStats& stats,
+                                                      std::int64_t locksUsedLastPeriod) {
+    std::int64_t evictionsLastPeriod = 0;
+    if (_prevApplicationEvictions >= 0 && stats.applicationEvictions >= _prevApplicationEvictions) {
+        evictionsLastPeriod = stats.applicationEvictions - _prevApplicationEvictions;
+    }
+    _prevApplicationEvictions = stats.applicationEvictions;
+
+    // Normalize each signal by its target, such that 1.0 means the signal is at its target, and
+    // combine them by taking the most pressing one. Flow control runs once per second, so the
+    // evictions of the last period approximate the eviction rate.
+    const double checkpointTargetMillis = 1000.0 * gFlowControlTargetCheckpointSeconds.load();
+    const double pressure = std::max(
+        {stats.dirtyCacheRatio / gFlowControlTargetDirtyCacheRatio.load(),
+         static_cast<double>(evictionsLastPeriod) /
+             gFlowControlTargetApplicationEvictionsPerSecond.load(),
+         durationCount<Milliseconds>(stats.lastCheckpointDuration) / checkpointTargetMillis});
+    _lastCachePressure.store(pressure);
+
+    // The integral term never goes negative, so a long period without pressure does not delay
+    // the reaction to new pressure.
+    const double error = pressure - 1.0;
+    _cachePressureIntegral =
+        std::min(std::max(_cachePressureIntegral + error, 0.0), kCachePressureMaxIntegral);
+    const double derivative = error - _lastCachePressureError;
+    _lastCachePressureError = error;
+
+    const double output = kCachePressureProportionalGain * error +
+        kCachePressureIntegralGain * _cachePressureIntegral +
+        kCachePressureDerivativeGain * derivative;
+
+    LOGV2_DEBUG(4930000,
+                DEBUG_LOG_LEVEL,
+                "Flow control cache pressure",
+                "dirtyCacheRatio"_attr = stats.dirtyCacheRatio,
+                "applicationEvictions"_attr = evictionsLastPeriod,
+                "lastCheckpointDuration"_attr = stats.lastCheckpointDuration,
+                "pressure"_attr = pressure,
+                "output"_attr = output);
+
+    if (output <= 0.0 || locksUsedLastPeriod <= 0) {
+        _isCachePressured.store(false);
+        return kMaxTickets;
+    }
+
+    if (!_isCachePressured.load()) {
+        _isCachePressured.store(true);
+        _isCachePressuredCount.fetchAndAddRelaxed(1);
+    }
+
+    // Scale down the lock acquisitions of the last period; an output of 1.0 halves them.
+    return multiplyWithOverflowCheck(
+        static_cast<double>(locksUsedLastPeriod), 1.0 / (1.0 + output), kMaxTickets);
+}
+
+int FlowControl::_getTicketsForCachePressure(std::int64_t locksUsedLastPeriod) {
+    StorageEngine* storageEngine = _service ? _service->getStorageEngine() : nullptr;
+    KVEngine* engine = storageEngine ? storageEngine->getEngine() : nullptr;
+    auto stats = engine ? engine->getCachePressureStats() : boost::none;
+    if (!stats) {
+        _resetCachePressureController();
+        return kMaxTickets;
+    }
+
+    return _calculateNewTicketsForCachePressure(*stats, locksUsedLastPeriod);
+}
+
+void FlowControl::_resetCachePressureController() {
+    _prevApplicationEvictions = -1;
+    _cachePressureIntegral = 0.0;
+    _lastCachePressureError = 0.0;
+    _lastCachePressure.store(0.0);
+    _lastCachePressureTicketsPermitted.store(kMaxTickets);
+    _isCachePressured.store(false);
+}
+
 int FlowControl::getNumTickets(Date_t now) {
     // Flow control can be disabled until a certain deadline is passed.
     const Date_t disabledUntil = _disableUntil.load();
@@ -405,6 +498,14 @@ int FlowControl::getNumTickets(Date_t now) {
         // variables here.
     }
 
+    if (gFlowControlCachePressureEnabled.load()) {
+        const int cachePressureTickets = _getTicketsForCachePressure(locksUsedLastPeriod);
+        _lastCachePressureTicketsPermitted.store(cachePressureTickets);
+        ret = std::min(ret, cachePressureTickets);
+    } else {
+        _resetCachePressureController();
+    }
+
     ret = std::max(ret, gFlowControlMinTicketsPerSecond.load());
 
     LOGV2_DEBUG(22220,
@@ -420,7 +521,8 @@ int FlowControl::getNumTickets(Date_t now) {
                 "acquisitionsSinceLastCheck"_attr = locksUsedLastPeriod,
                 "locksPerOp"_attr = _lastLocksPerOp.load(),
                 "countOfLaggedPeriods"_attr = _isLaggedCount.load(),
-                "totalDurationOfLaggedPeriods"_attr = _isLaggedTimeMicros.load());
+                "totalDurationOfLaggedPeriods"_attr = _isLaggedTimeMicros.load(),
+                "cachePressure"_attr = _lastCachePressure.load());
 
     _lastTargetTicketsPermitted.store(ret);
 
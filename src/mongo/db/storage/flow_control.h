@@ -36,6 +36,7 @@
 #include "mongo/db/repl/member_data.h"
 #include "mongo/db/repl/replication_coordinator_fwd.h"
 #include "mongo/db/service_context.h"
+#include "mongo/db/storage/cache_pressure_stats.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
 
@@ -50,6 +51,10 @@ namespace mongo {
  *
  * Otherwise this class' only output is to refresh the tickets available in the
  * `FlowControlTicketholder`.
+ *
+ * When `flowControlCachePressureEnabled` is set, the ticket count is additionally capped by a
+ * controller that tracks the storage engine's cache pressure, so writes are slowed down before a
+ * saturated cache causes the commit point to lag in the first place.
  */
 class FlowControl : public ServerStatusSection {
 public:
@@ -127,6 +132,8 @@ public:
                                    double locksPerOp,
                                    std::uint64_t lagMillis,
                                    std::uint64_t thresholdLagMillis);
+    int _calculateNewTicketsForCachePressure(const CachePressureStats& stats,
+                                             std::int64_t locksUsedLastPeriod);
     void _trimSamples(const Timestamp trimSamplesTo);
 
     // Sample of (timestamp, ops, lock acquisitions) where ops and lock acquisitions are
@@ -137,6 +144,16 @@ public:
     }
 
 private:
+    /**
+     * Returns the number of tickets the cache pressure controller permits for the next period, or
+     * kMaxTickets if the storage engine does not report cache pressure.
+     */
+    int _getTicketsForCachePressure(std::int64_t locksUsedLastPeriod);
+
+    void _resetCachePressureController();
+
+    // Null when constructed for testing.
+    ServiceContext* _service = nullptr;
     repl::ReplicationCoordinator* _replCoord;
 
     // These values are updated with each flow control computation and are also surfaced in server
@@ -149,6 +166,10 @@ private:
     // Use an int64_t as this is serialized to bson which does not support unsigned 64-bit numbers.
     AtomicWord<std::int64_t> _isLaggedTimeMicros{0};
     AtomicWord<Date_t> _disableUntil;
+    AtomicWord<double> _lastCachePressure{0.0};
+    AtomicWord<int> _lastCachePressureTicketsPermitted{kMaxTickets};
+    AtomicWord<bool> _isCachePressured{false};
+    AtomicWord<int> _isCachePressuredCount{0};
 
     mutable Mutex _sampledOpsMutex = MONGO_MAKE_LATCH("FlowControl::_sampledOpsMutex");
     std::deque<Sample> _sampledOpsApplied;
@@ -164,6 +185,12 @@ private:
 
     Date_t _lastTimeSustainerAdvanced;
 
+    // State of the cache pressure controller. The application evictions counter reported by the
+    // storage engine is cumulative, so the previous observation is kept to compute the rate.
+    std::int64_t _prevApplicationEvictions = -1;
+    double _cachePressureIntegral = 0.0;
+    double _lastCachePressureError = 0.0;
+
     // This value is used for calculating server status metrics.
     std::uint64_t _startWaitTime = 0;
 
@@ -249,6 +249,49 @@ TEST_F(FlowControlTest, CalculatingTickets) {
                                                       thresholdLag));
 }
 
+TEST_F(FlowControlTest, CalculatingTicketsForCachePressure) {
+    gFlowControlTargetDirtyCacheRatio.store(0.1);
+    gFlowControlTargetApplicationEvictionsPerSecond.store(100);
+    gFlowControlTargetCheckpointSeconds.store(60);
+
+    const std::int64_t locksUsedLastPeriod = 1000;
+    CachePressureStats stats;
+
+    // Every signal below its target permits an unlimited number of tickets.
+    stats.dirtyCacheRatio = 0.05;
+    stats.applicationEvictions = 0;
+    stats.lastCheckpointDuration = Seconds(10);
+    ASSERT_EQ(FlowControl::kMaxTickets,
+              flowControl->_calculateNewTicketsForCachePressure(stats, locksUsedLastPeriod));
+
+    // Application threads evicting pages faster than the target throttles writes, even though
+    // the other signals are healthy.
+    stats.applicationEvictions = 400;
+    const int evictionTickets =
+        flowControl->_calculateNewTicketsForCachePressure(stats, locksUsedLastPeriod);
+    ASSERT_LT(evictionTickets, locksUsedLastPeriod);
+    ASSERT_GT(evictionTickets, 0);
+
+    // Growing pressure throttles harder.
+    stats.applicationEvictions = 1400;
+    ASSERT_LT(flowControl->_calculateNewTicketsForCachePressure(stats, locksUsedLastPeriod),
+              evictionTickets);
+
+    // A long checkpoint is treated as pressure.
+    stats.dirtyCacheRatio = 0.05;
+    stats.lastCheckpointDuration = Seconds(120);
+    ASSERT_LT(flowControl->_calculateNewTicketsForCachePressure(stats, locksUsedLastPeriod),
+              locksUsedLastPeriod);
+
+    // Once all the signals recover, the accumulated error drains and writes are unthrottled.
+    stats.lastCheckpointDuration = Seconds(10);
+    int tickets = 0;
+    for (int i = 0; i < 10 && tickets != FlowControl::kMaxTickets; ++i) {
+        tickets = flowControl->_calculateNewTicketsForCachePressure(stats, locksUsedLastPeriod);
+    }
+    ASSERT_EQ(FlowControl::kMaxTickets, tickets);
+}
+
 TEST_F(FlowControlTest, DisableUntil) {
     const int ticketOverride = 52319;
 
@@ -37,6 +37,7 @@
 #include "mongo/base/string_data.h"
 #include "mongo/bson/timestamp.h"
 #include "mongo/db/catalog/collection_options.h"
+#include "mongo/db/storage/cache_pressure_stats.h"
 #include "mongo/db/storage/kv/kv_prefix.h"
 #include "mongo/db/storage/record_store.h"
 #include "mongo/db/storage/sorted_data_interface.h"
@@ -438,6 +439,14 @@ public:
         MONGO_UNREACHABLE;
     }
 
+    /**
+     * Returns the current cache pressure indicators, or boost::none if the storage engine does not
+     * track them. Used by flow control to throttle writes before the cache becomes saturated.
+     */
+    virtual boost::optional<CachePressureStats> getCachePressureStats() const {
+        return boost::none;
+    }
+
     /**
      * The destructor will never be called from mongod, but may be called from tests.
      * Engines may assume that this will only be called in the case of clean shutdown, even if
@@ -2250,6 +2250,35 @@ Timestamp WiredTigerKVEngine::getOldestOpenReadTimestamp() const {
     return Timestamp(tmp);
 }
 
+boost::optional<CachePressureStats> WiredTigerKVEngine::getCachePressureStats() const {
+    // An in-memory engine holds all data in the cache, so dirty data does not indicate pressure.
+    if (_ephemeral) {
+        return boost::none;
+    }
+
+    UniqueWiredTigerSession session = _sessionCache->getSession();
+    auto getStat = [&](int key) {
+        return WiredTigerUtil::getStatisticsValue(
+            session->getSession(), "statistics:", "statistics=(fast)", key);
+    };
+
+    auto cacheBytesMax = getStat(WT_STAT_CONN_CACHE_BYTES_MAX);
+    auto cacheBytesDirty = getStat(WT_STAT_CONN_CACHE_BYTES_DIRTY);
+    auto applicationEvictions = getStat(WT_STAT_CONN_CACHE_EVICTION_APP);
+    auto checkpointTimeMillis = getStat(WT_STAT_CONN_TXN_CHECKPOINT_TIME_RECENT);
+    if (!cacheBytesMax.isOK() || !cacheBytesDirty.isOK() || !applicationEvictions.isOK() ||
+        !checkpointTimeMillis.isOK() || cacheBytesMax.getValue() <= 0) {
+        return boost::none;
+    }
+
+    CachePressureStats stats;
+    stats.dirtyCacheRatio =
+        static_cast<double>(cacheBytesDirty.getValue()) / cacheBytesMax.getValue();
+    stats.applicationEvictions = applicationEvictions.getValue();
+    stats.lastCheckpointDuration = Milliseconds(checkpointTimeMillis.getValue());
+    return stats;
+}
+
 boost::optional<Timestamp> WiredTigerKVEngine::getRecoveryTimestamp() const {
     if (!supportsRecoveryTimestamp()) {
         LOGV2_FATAL(50745,
@@ -323,6 +323,8 @@ public:
     Timestamp getOldestTimestamp() const override;
     Timestamp getCheckpointTimestamp() const override;
 
+    boost::optional<CachePressureStats> getCachePressureStats() const override;
+
     Timestamp getInitialDataTimestamp() const;
 
     /**
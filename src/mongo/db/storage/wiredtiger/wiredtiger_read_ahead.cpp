@@ -0,0 +1,127 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/storage/wiredtiger/wiredtiger_read_ahead.h"
+
+#include <algorithm>
+
+#if !defined(_WIN32)
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "mongo/logv2/log.h"
+#include "mongo/platform/posix_fadvise.h"
+
+namespace mongo {
+
+#if defined(POSIX_FADV_WILLNEED)
+
+WiredTigerReadAhead::WiredTigerReadAhead(const boost::filesystem::path& dataFile,
+                                         std::int64_t windowBytes,
+                                         std::int64_t logicalDataSize)
+    : _windowBytes(windowBytes) {
+    _fd = ::open(dataFile.string().c_str(), O_RDONLY);
+    if (_fd < 0) {
+        LOGV2_DEBUG(4939100,
+                    2,
+                    "Unable to open data file for read-ahead",
+                    "file"_attr = dataFile.string());
+        return;
+    }
+
+    struct stat st;
+    if (::fstat(_fd, &st) != 0) {
+        ::close(_fd);
+        _fd = -1;
+        return;
+    }
+
+    _fileSize = st.st_size;
+    if (logicalDataSize > 0) {
+        _diskBytesPerLogicalByte =
+            std::min(1.0, static_cast<double>(_fileSize) / static_cast<double>(logicalDataSize));
+    }
+
+    _requestNextWindow();
+}
+
+WiredTigerReadAhead::~WiredTigerReadAhead() {
+    if (_fd >= 0) {
+        ::close(_fd);
+    }
+}
+
+void WiredTigerReadAhead::consumed(std::int64_t logicalBytes) {
+    if (!isActive()) {
+        return;
+    }
+
+    _estimatedOffset += logicalBytes * _diskBytesPerLogicalByte;
+    if (_estimatedOffset + _windowBytes / 2 >= _requestedUpTo) {
+        _requestNextWindow();
+    }
+}
+
+void WiredTigerReadAhead::_requestNextWindow() {
+    // Never request more than one window beyond the estimated scan position, so that a scan which
+    // is abandoned early does not leave a large amount of unwanted reads queued.
+    const auto estimatedOffset = static_cast<std::int64_t>(_estimatedOffset);
+    const auto start = std::max(_requestedUpTo, estimatedOffset);
+    const auto end = std::min(_fileSize, estimatedOffset + _windowBytes);
+    if (end <= start) {
+        return;
+    }
+
+    // The hint is advisory: on failure the scan simply falls back to synchronous reads.
+    posix_fadvise(_fd, start, end - start, POSIX_FADV_WILLNEED);
+    _requestedUpTo = end;
+}
+
+#else
+
+WiredTigerReadAhead::WiredTigerReadAhead(const boost::filesystem::path& dataFile,
+                                         std::int64_t windowBytes,
+                                         std::int64_t logicalDataSize)
+    : _windowBytes(windowBytes) {}
+
+WiredTigerReadAhead::~WiredTigerReadAhead() = default;
+
+void WiredTigerReadAhead::consumed(std::int64_t logicalBytes) {}
+
+void WiredTigerReadAhead::_requestNextWindow() {}
+
+#endif
+
+}  // namespace mongo
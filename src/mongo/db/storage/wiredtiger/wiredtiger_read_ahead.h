@@ -0,0 +1,101 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#pragma once
+
+#include <boost/filesystem/path.hpp>
+#include <cstdint>
+
+namespace mongo {
+
+/**
+ * Issues asynchronous read-ahead hints to the operating system for the data file backing a
+ * WiredTiger table while it is being scanned sequentially.
+ *
+ * WiredTiger does not expose the block offsets of the pages a cursor is about to visit, so the
+ * scan position within the file is approximated by the number of bytes the scan has consumed,
+ * scaled by the ratio of the on-disk file size to the logical data size of the table. Hints are
+ * issued with POSIX_FADV_WILLNEED, which schedules the reads without blocking the caller, and are
+ * bounded so that at most 'windowBytes' of the file are requested ahead of the estimated scan
+ * position at any time.
+ *
+ * On platforms without posix_fadvise() this class does nothing.
+ */
+class WiredTigerReadAhead {
+    WiredTigerReadAhead(const WiredTigerReadAhead&) = delete;
+    WiredTigerReadAhead& operator=(const WiredTigerReadAhead&) = delete;
+
+public:
+    /**
+     * 'logicalDataSize' is the uncompressed size of the records stored in 'dataFile', as reported
+     * by the record store. If the file cannot be opened, the object is constructed inactive.
+     */
+    WiredTigerReadAhead(const boost::filesystem::path& dataFile,
+                        std::int64_t windowBytes,
+                        std::int64_t logicalDataSize);
+
+    ~WiredTigerReadAhead();
+
+    /**
+     * Records that the scan has consumed another 'logicalBytes' of record data, and issues a hint
+     * for the next window of the file once the estimated scan position has passed the middle of
+     * the window most recently requested.
+     */
+    void consumed(std::int64_t logicalBytes);
+
+    /**
+     * Returns true if the data file was opened and the end of it has not been requested yet.
+     */
+    bool isActive() const {
+        return _fd >= 0 && _requestedUpTo < _fileSize;
+    }
+
+    /**
+     * Returns the file offset up to which reads have been requested so far.
+     */
+    std::int64_t requestedUpTo() const {
+        return _requestedUpTo;
+    }
+
+private:
+    void _requestNextWindow();
+
+    int _fd = -1;
+    const std::int64_t _windowBytes;
+    std::int64_t _fileSize = 0;
+
+    // Ratio of on-disk bytes to logical bytes, used to map consumed record data to a file offset.
+    double _diskBytesPerLogicalByte = 1.0;
+
+    double _estimatedOffset = 0;
+    std::int64_t _requestedUpTo = 0;
+};
+
+}  // namespace mongo
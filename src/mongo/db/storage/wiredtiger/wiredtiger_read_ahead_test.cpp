@@ -0,0 +1,114 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#include "mongo/platform/basic.h"
+
+#include <fstream>
+#include <string>
+
+#include "mongo/db/storage/wiredtiger/wiredtiger_read_ahead.h"
+#include "mongo/platform/posix_fadvise.h"
+#include "mongo/unittest/temp_dir.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+#if defined(POSIX_FADV_WILLNEED)
+
+const std::int64_t kFileSize = 1024 * 1024;
+const std::int64_t kWindow = 64 * 1024;
+
+boost::filesystem::path makeDataFile(unittest::TempDir& dir) {
+    boost::filesystem::path file(dir.path());
+    file /= "collection-0.wt";
+    std::ofstream out(file.string(), std::ios::binary);
+    out << std::string(kFileSize, 'x');
+    return file;
+}
+
+TEST(WiredTigerReadAheadTest, RequestsFirstWindowOnConstruction) {
+    unittest::TempDir dir("wiredtiger_read_ahead_test");
+    WiredTigerReadAhead readAhead(makeDataFile(dir), kWindow, kFileSize);
+    ASSERT_TRUE(readAhead.isActive());
+    ASSERT_EQ(kWindow, readAhead.requestedUpTo());
+}
+
+TEST(WiredTigerReadAheadTest, AdvancesWindowWithScanPosition) {
+    unittest::TempDir dir("wiredtiger_read_ahead_test");
+    WiredTigerReadAhead readAhead(makeDataFile(dir), kWindow, kFileSize);
+
+    // Nothing new is requested until the scan passes the middle of the current window.
+    readAhead.consumed(kWindow / 4);
+    ASSERT_EQ(kWindow, readAhead.requestedUpTo());
+
+    readAhead.consumed(kWindow / 4);
+    ASSERT_EQ(kWindow / 2 + kWindow, readAhead.requestedUpTo());
+}
+
+TEST(WiredTigerReadAheadTest, ScalesLogicalBytesByCompressionRatio) {
+    unittest::TempDir dir("wiredtiger_read_ahead_test");
+    // The logical data is four times larger than the file, as if it were compressed.
+    WiredTigerReadAhead readAhead(makeDataFile(dir), kWindow, 4 * kFileSize);
+
+    readAhead.consumed(kWindow);
+    ASSERT_EQ(kWindow, readAhead.requestedUpTo());
+
+    readAhead.consumed(kWindow);
+    ASSERT_EQ(kWindow / 2 + kWindow, readAhead.requestedUpTo());
+}
+
+TEST(WiredTigerReadAheadTest, StopsAtEndOfFile) {
+    unittest::TempDir dir("wiredtiger_read_ahead_test");
+    WiredTigerReadAhead readAhead(makeDataFile(dir), kWindow, kFileSize);
+
+    for (std::int64_t consumed = 0; consumed < kFileSize; consumed += kWindow / 8) {
+        readAhead.consumed(kWindow / 8);
+        ASSERT_LTE(readAhead.requestedUpTo(), kFileSize);
+    }
+    ASSERT_EQ(kFileSize, readAhead.requestedUpTo());
+    ASSERT_FALSE(readAhead.isActive());
+}
+
+TEST(WiredTigerReadAheadTest, InactiveWhenFileIsMissing) {
+    unittest::TempDir dir("wiredtiger_read_ahead_test");
+    boost::filesystem::path file(dir.path());
+    file /= "missing.wt";
+    WiredTigerReadAhead readAhead(file, kWindow, kFileSize);
+    ASSERT_FALSE(readAhead.isActive());
+
+    readAhead.consumed(kFileSize);
+    ASSERT_EQ(0, readAhead.requestedUpTo());
+}
+
+#endif
+
+}  // namespace
+}  // namespace mongo
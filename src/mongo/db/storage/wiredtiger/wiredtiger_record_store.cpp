@@ -57,6 +57,7 @@
 #include "mongo/db/storage/wiredtiger/wiredtiger_customization_hooks.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_global_options.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_kv_engine.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_parameters_gen.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_prepare_conflict.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_record_store_oplog_stones.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_recovery_unit.h"
@@ -96,6 +97,11 @@ MONGO_STATIC_ASSERT(kCurrentRecordStoreVersion <= kMaximumRecordStoreVersion);
 
 const double kNumMSInHour = 1000 * 60 * 60;
 
+// The number of records a forward scan from the beginning of a table must return before it is
+// considered sequential and read-ahead is started for it. This keeps short scans, such as those
+// satisfying a limit, from opening the data file.
+const std::int64_t kReadAheadMinSequentialRecords = 128;
+
 void checkOplogFormatVersion(OperationContext* opCtx, const std::string& uri) {
     StatusWith<BSONObj> appMetadata = WiredTigerUtil::getApplicationMetadata(opCtx, uri);
     fassert(39999, appMetadata);
@@ -2129,6 +2135,13 @@ boost::optional<Record> WiredTigerRecordStoreCursorBase::next() {
 
     WT_CURSOR* c = _cursor->get();
 
+    if (_lastReturnedId.isNull() && !_skipNextAdvance) {
+        // Starting from the beginning of the table. The oplog is excluded because its readers
+        // usually tail the end of it rather than scanning it in full.
+        _stopReadAhead();
+        _scanningFromStart = _forward && !_rs._isOplog;
+    }
+
     RecordId id;
     if (!_skipNextAdvance) {
         // Nothing after the next line can throw WCEs.
@@ -2176,12 +2189,50 @@ boost::optional<Record> WiredTigerRecordStoreCursorBase::next() {
     WT_ITEM value;
     invariantWTOK(c->get_value(c, &value));
 
+    if (_readAhead) {
+        _readAhead->consumed(value.size);
+    } else if (_scanningFromStart) {
+        _maybeStartReadAhead(value.size);
+    }
+
     _lastReturnedId = id;
     return {{id, {static_cast<const char*>(value.data), static_cast<int>(value.size)}}};
 }
 
+void WiredTigerRecordStoreCursorBase::_maybeStartReadAhead(std::int64_t recordBytes) {
+    _scannedBytes += recordBytes;
+    if (++_scannedRecords < kReadAheadMinSequentialRecords) {
+        return;
+    }
+
+    // Whether or not read-ahead can be started, do not evaluate it again for this scan.
+    _scanningFromStart = false;
+
+    const std::int64_t windowKB = gWiredTigerCollectionScanReadAheadKB.load();
+    if (windowKB <= 0) {
+        return;
+    }
+
+    auto dataFile = _rs._kvEngine->getDataFilePathForIdent(_rs.getIdent());
+    if (!dataFile) {
+        return;
+    }
+
+    _readAhead = std::make_unique<WiredTigerReadAhead>(
+        *dataFile, windowKB * 1024, _rs.dataSize(_opCtx));
+    _readAhead->consumed(_scannedBytes);
+}
+
+void WiredTigerRecordStoreCursorBase::_stopReadAhead() {
+    _scanningFromStart = false;
+    _scannedRecords = 0;
+    _scannedBytes = 0;
+    _readAhead.reset();
+}
+
 boost::optional<Record> WiredTigerRecordStoreCursorBase::seekExact(const RecordId& id) {
     invariant(_hasRestored);
+    _stopReadAhead();
     if (_oplogVisibleTs && id.repr() > *_oplogVisibleTs) {
         _eof = true;
         return {};
@@ -2227,6 +2278,7 @@ void WiredTigerRecordStoreCursorBase::save() {
 
 void WiredTigerRecordStoreCursorBase::saveUnpositioned() {
     save();
+    _stopReadAhead();
     _lastReturnedId = RecordId();
 }
 
@@ -40,6 +40,7 @@
 #include "mongo/db/storage/record_store.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_cursor.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_kv_engine.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_read_ahead.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_recovery_unit.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_size_storer.h"
 #include "mongo/platform/atomic_word.h"
@@ -449,6 +450,14 @@ public:
 
     void saveUnpositioned();
 
+    /**
+     * Returns whether read-ahead has been started for the scan this cursor is performing. Used for
+     * testing.
+     */
+    bool isReadingAheadForTest() const {
+        return _readAhead != nullptr;
+    }
+
     bool restore();
 
     void detachFromOperationContext();
@@ -486,6 +495,22 @@ protected:
 private:
     bool isVisible(const RecordId& id);
 
+    /**
+     * Called for every record returned by next() while scanning from the beginning of the table.
+     * Once the scan has returned enough records to be considered sequential, starts issuing
+     * read-ahead for the table's data file.
+     */
+    void _maybeStartReadAhead(std::int64_t recordBytes);
+
+    void _stopReadAhead();
+
+    // True while this cursor is performing a forward scan that started at the beginning of the
+    // table and has not been repositioned since.
+    bool _scanningFromStart = false;
+    std::int64_t _scannedRecords = 0;
+    std::int64_t _scannedBytes = 0;
+    std::unique_ptr<WiredTigerReadAhead> _readAhead;
+
     /**
      * This value is used for visibility calculations on what oplog entries can be returned to a
      * client. This value *must* be initialized/updated *before* a WiredTiger snapshot is
@@ -48,6 +48,7 @@
 #include "mongo/db/storage/kv/kv_prefix.h"
 #include "mongo/db/storage/record_store_test_harness.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_kv_engine.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_parameters_gen.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_record_store.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_record_store_oplog_stones.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_recovery_unit.h"
@@ -213,6 +214,74 @@ TEST(WiredTigerRecordStoreTest, StorageSizeStatisticsDisabled) {
     ASSERT_THROWS(rs->storageSize(opCtx.get()), AssertionException);
 }
 
+TEST(WiredTigerRecordStoreTest, ReadAheadStartsOnlyForSequentialScansFromStart) {
+    const auto originalReadAheadKB = gWiredTigerCollectionScanReadAheadKB.load();
+    gWiredTigerCollectionScanReadAheadKB.store(64);
+    ON_BLOCK_EXIT([&] { gWiredTigerCollectionScanReadAheadKB.store(originalReadAheadKB); });
+
+    WiredTigerHarnessHelper harnessHelper;
+    unique_ptr<RecordStore> rs(harnessHelper.newNonCappedRecordStore("a.b"));
+    ServiceContext::UniqueOperationContext opCtx(harnessHelper.newOperationContext());
+
+    const int kNumRecords = 200;
+    std::vector<RecordId> recordIds;
+    {
+        WriteUnitOfWork uow(opCtx.get());
+        for (int i = 0; i < kNumRecords; i++) {
+            StatusWith<RecordId> res = rs->insertRecord(opCtx.get(), "a", 2, Timestamp());
+            ASSERT_OK(res.getStatus());
+            recordIds.push_back(res.getValue());
+        }
+        uow.commit();
+    }
+
+    // A forward scan from the start of the collection starts read-ahead once it has returned
+    // enough records to be considered sequential.
+    {
+        auto cursor = rs->getCursor(opCtx.get());
+        auto wtCursor = dynamic_cast<WiredTigerRecordStoreCursorBase*>(cursor.get());
+        ASSERT(wtCursor);
+        for (int i = 0; i < 127; i++) {
+            ASSERT(cursor->next());
+            ASSERT_FALSE(wtCursor->isReadingAheadForTest());
+        }
+        ASSERT(cursor->next());
+        ASSERT_TRUE(wtCursor->isReadingAheadForTest());
+
+        // Repositioning the cursor means the scan is no longer sequential.
+        ASSERT(cursor->seekExact(recordIds[10]));
+        ASSERT_FALSE(wtCursor->isReadingAheadForTest());
+        for (int i = 0; i < 150; i++) {
+            ASSERT(cursor->next());
+            ASSERT_FALSE(wtCursor->isReadingAheadForTest());
+        }
+    }
+
+    // Reverse scans never read ahead.
+    {
+        const bool forward = false;
+        auto cursor = rs->getCursor(opCtx.get(), forward);
+        auto wtCursor = dynamic_cast<WiredTigerRecordStoreCursorBase*>(cursor.get());
+        ASSERT(wtCursor);
+        for (int i = 0; i < kNumRecords; i++) {
+            ASSERT(cursor->next());
+            ASSERT_FALSE(wtCursor->isReadingAheadForTest());
+        }
+    }
+
+    // Read-ahead is not started when it is disabled.
+    {
+        gWiredTigerCollectionScanReadAheadKB.store(0);
+        auto cursor = rs->getCursor(opCtx.get());
+        auto wtCursor = dynamic_cast<WiredTigerRecordStoreCursorBase*>(cursor.get());
+        ASSERT(wtCursor);
+        for (int i = 0; i < kNumRecords; i++) {
+            ASSERT(cursor->next());
+            ASSERT_FALSE(wtCursor->isReadingAheadForTest());
+        }
+    }
+}
+
 TEST(WiredTigerRecordStoreTest, SizeStorer1) {
     unique_ptr<WiredTigerHarnessHelper> harnessHelper(new WiredTigerHarnessHelper());
     unique_ptr<RecordStore> rs(harnessHelper->newNonCappedRecordStore());
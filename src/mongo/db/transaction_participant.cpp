@@ -249,13 +249,11 @@ void updateSessionEntry(OperationContext* opCtx, const UpdateRequest& updateRequ
     auto originalRecordData = collection->getRecordStore()->dataFor(opCtx, recordId);
     auto originalDoc = originalRecordData.toBson();
 
+    // The query only ever consists of the session id, so rather than parsing it into a full
+    // MatchExpression on every retryable write, compare the _id of the fetched document directly.
     invariant(collection->getDefaultCollator() == nullptr);
-    boost::intrusive_ptr<ExpressionContext> expCtx(
-        new ExpressionContext(opCtx, nullptr, updateRequest.getNamespaceString()));
-
-    auto matcher =
-        fassert(40673, MatchExpressionParser::parse(updateRequest.getQuery(), std::move(expCtx)));
-    if (!matcher->matchesBSON(originalDoc)) {
+    dassert(updateRequest.getQuery().nFields() == 1);
+    if (!originalDoc["_id"].binaryEqualValues(idToFetch)) {
         // Document no longer match what we expect so throw WCE to make the caller re-examine.
         throw WriteConflictException();
     }
@@ -121,6 +121,27 @@ std::unique_ptr<mongo::DBClientCursor> MockDBClientConnection::query(
                                                      batchSize,
                                                      readConcernObj));
 
+        // A simple mock implementation of $min and $max index bounds on a single field, where
+        // documents outside of the range [$min, $max) are filtered out.
+        const BSONObj min = query.obj.getObjectField("$min");
+        const BSONObj max = query.obj.getObjectField("$max");
+        if (!min.isEmpty() || !max.isEmpty()) {
+            BSONArrayBuilder builder;
+            for (auto&& elem : result) {
+                BSONObj doc = elem.Obj();
+                if (!min.isEmpty() &&
+                    doc[min.firstElementFieldName()].woCompare(min.firstElement(), false) < 0) {
+                    continue;
+                }
+                if (!max.isEmpty() &&
+                    doc[max.firstElementFieldName()].woCompare(max.firstElement(), false) >= 0) {
+                    continue;
+                }
+                builder.append(doc);
+            }
+            result = BSONArray(builder.obj());
+        }
+
         BSONArray resultsInCursor;
 
         // A simple mock implementation of a resumable query, where we skip the first 'n' fields
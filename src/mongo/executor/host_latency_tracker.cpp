@@ -0,0 +1,177 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/executor/host_latency_tracker.h"
+
+#include <cmath>
+
+#include "mongo/platform/bits.h"
+
+namespace mongo {
+
+namespace {
+const auto getHostLatencyTracker = ServiceContext::declareDecoration<HostLatencyTracker>();
+}  // namespace
+
+HostLatencyTracker::HostLatencyTracker() : _random(SecureRandom().nextInt64()) {}
+
+HostLatencyTracker* HostLatencyTracker::get(ServiceContext* service) {
+    return &getHostLatencyTracker(service);
+}
+
+void HostLatencyTracker::onRequestStarted(const HostAndPort& host) {
+    stdx::lock_guard<Latch> lk(_mutex);
+    _hostStats[host].numInFlight++;
+}
+
+void HostLatencyTracker::onRequestFinished(const HostAndPort& host,
+                                           boost::optional<Milliseconds> latency) {
+    stdx::lock_guard<Latch> lk(_mutex);
+    auto& stats = _hostStats[host];
+    if (stats.numInFlight > 0) {
+        stats.numInFlight--;
+    }
+
+    if (!latency) {
+        return;
+    }
+
+    stats.buckets[_bucketFor(*latency)]++;
+    if (++stats.numSamples < kDecayThreshold) {
+        return;
+    }
+
+    stats.numSamples = 0;
+    for (auto& count : stats.buckets) {
+        count /= 2;
+        stats.numSamples += count;
+    }
+}
+
+boost::optional<Milliseconds> HostLatencyTracker::getLatencyPercentile(const HostAndPort& host,
+                                                                       double percentile) const {
+    stdx::lock_guard<Latch> lk(_mutex);
+    auto it = _hostStats.find(host);
+    if (it == _hostStats.end()) {
+        return boost::none;
+    }
+
+    return _getLatencyPercentile(lk, it->second, percentile);
+}
+
+std::vector<HostAndPort> HostLatencyTracker::selectHosts(const std::vector<HostAndPort>& hosts,
+                                                         size_t count) {
+    if (hosts.size() < 2 || count == 0) {
+        return hosts;
+    }
+
+    stdx::lock_guard<Latch> lk(_mutex);
+
+    const auto first = _random.nextInt64(hosts.size());
+    auto second = _random.nextInt64(hosts.size() - 1);
+    if (second >= first) {
+        second++;
+    }
+
+    std::vector<HostAndPort> selected{hosts[first], hosts[second]};
+    if (_getExpectedLatency(lk, selected[1]) < _getExpectedLatency(lk, selected[0])) {
+        std::swap(selected[0], selected[1]);
+    }
+
+    selected.resize(std::min(count, selected.size()));
+    return selected;
+}
+
+size_t HostLatencyTracker::_bucketFor(Milliseconds latency) {
+    const auto millis = std::max<long long>(latency.count(), 0);
+    if (millis < kSubBuckets) {
+        return millis;
+    }
+
+    // The power of two the latency falls in selects a group of kSubBuckets buckets and the two bits
+    // following the most significant one select the bucket within that group
+    const int log2 = 63 - countLeadingZeros64(millis);
+    const auto subBucket = (millis >> (log2 - 2)) & (kSubBuckets - 1);
+
+    return std::min<size_t>((log2 - 1) * kSubBuckets + subBucket, kNumBuckets - 1);
+}
+
+Milliseconds HostLatencyTracker::_bucketUpperBound(size_t bucket) {
+    if (bucket < kSubBuckets) {
+        return Milliseconds(static_cast<long long>(bucket));
+    }
+
+    const int log2 = static_cast<int>(bucket / kSubBuckets) + 1;
+    const long long subBucket = static_cast<long long>(bucket % kSubBuckets);
+    const long long lowerBound = (kSubBuckets + subBucket) << (log2 - 2);
+
+    return Milliseconds(lowerBound + (1LL << (log2 - 2)) - 1);
+}
+
+boost::optional<Milliseconds> HostLatencyTracker::_getLatencyPercentile(WithLock,
+                                                                        const HostStats& stats,
+                                                                        double percentile) const {
+    if (stats.numSamples < kMinSamples) {
+        return boost::none;
+    }
+
+    const auto target =
+        std::max(1LL, static_cast<long long>(std::ceil(stats.numSamples * percentile / 100)));
+
+    long long seen = 0;
+    for (size_t bucket = 0; bucket < stats.buckets.size(); bucket++) {
+        seen += stats.buckets[bucket];
+        if (seen >= target) {
+            return _bucketUpperBound(bucket);
+        }
+    }
+
+    return _bucketUpperBound(kNumBuckets - 1);
+}
+
+double HostLatencyTracker::_getExpectedLatency(WithLock lk, const HostAndPort& host) const {
+    auto it = _hostStats.find(host);
+    if (it == _hostStats.end()) {
+        return 0;
+    }
+
+    const auto& stats = it->second;
+    const auto p95 = _getLatencyPercentile(lk, stats, 95);
+    if (!p95) {
+        return 0;
+    }
+
+    // Add one to the latency so that an idle host which answers within a millisecond is still
+    // preferred over a busy one
+    return static_cast<double>(durationCount<Milliseconds>(*p95) + 1) * (stats.numInFlight + 1);
+}
+
+}  // namespace mongo
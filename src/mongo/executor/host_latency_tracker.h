@@ -0,0 +1,125 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <array>
+#include <map>
+#include <vector>
+
+#include "mongo/db/service_context.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/platform/random.h"
+#include "mongo/util/concurrency/with_lock.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/net/hostandport.h"
+
+namespace mongo {
+
+/**
+ * Keeps a histogram of the latency of the remote commands recently run against each host, along
+ * with the number of commands currently in flight to it. Used to route reads away from hosts which
+ * are slow at the moment and to only hedge a read once it has taken longer than its target usually
+ * takes.
+ */
+class HostLatencyTracker {
+    HostLatencyTracker(const HostLatencyTracker&) = delete;
+    HostLatencyTracker& operator=(const HostLatencyTracker&) = delete;
+
+public:
+    // Number of samples a host needs before its latency percentiles are reported.
+    static constexpr long long kMinSamples = 20;
+
+    // Once a host has this many samples, all of its counts are halved, so that the histogram
+    // follows changes in the host's latency instead of averaging over its whole history.
+    static constexpr long long kDecayThreshold = 1000;
+
+    HostLatencyTracker();
+
+    static HostLatencyTracker* get(ServiceContext* service);
+
+    /**
+     * Must be called whenever a command is sent to 'host', and be followed by a call to
+     * onRequestFinished once its response, or error, has been received.
+     */
+    void onRequestStarted(const HostAndPort& host);
+
+    /**
+     * Records the completion of a command against 'host'. The latency should only be provided if
+     * the command actually ran to completion on the host, because commands which were cancelled
+     * or failed to reach it say nothing about how fast it is.
+     */
+    void onRequestFinished(const HostAndPort& host, boost::optional<Milliseconds> latency);
+
+    /**
+     * Returns the latency within which 'percentile' percent of the commands recently run against
+     * 'host' completed, or boost::none if not enough of them have been observed yet.
+     */
+    boost::optional<Milliseconds> getLatencyPercentile(const HostAndPort& host,
+                                                       double percentile) const;
+
+    /**
+     * Picks at most 'count' hosts from 'hosts' using the power of two choices: two distinct hosts
+     * are sampled at random and ordered by their expected latency, which is their 95th percentile
+     * latency scaled by the number of commands in flight to them. Hosts without enough samples are
+     * expected to be fast, so that they get explored.
+     *
+     * Returns 'hosts' unchanged if there are no two hosts to choose from.
+     */
+    std::vector<HostAndPort> selectHosts(const std::vector<HostAndPort>& hosts, size_t count);
+
+private:
+    // Latencies are bucketed on a logarithmic scale with kSubBuckets buckets per power of two,
+    // which bounds the error of the reported percentiles to a quarter of their value.
+    static constexpr int kSubBuckets = 4;
+    static constexpr int kNumBuckets = 80;
+
+    struct HostStats {
+        std::array<long long, kNumBuckets> buckets{};
+        long long numSamples{0};
+        long long numInFlight{0};
+    };
+
+    static size_t _bucketFor(Milliseconds latency);
+    static Milliseconds _bucketUpperBound(size_t bucket);
+
+    boost::optional<Milliseconds> _getLatencyPercentile(WithLock,
+                                                        const HostStats& stats,
+                                                        double percentile) const;
+
+    double _getExpectedLatency(WithLock, const HostAndPort& host) const;
+
+    mutable Mutex _mutex = MONGO_MAKE_LATCH("HostLatencyTracker::_mutex");
+
+    std::map<HostAndPort, HostStats> _hostStats;
+
+    PseudoRandom _random;
+};
+
+}  // namespace mongo
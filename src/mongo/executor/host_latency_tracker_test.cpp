@@ -0,0 +1,139 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/executor/host_latency_tracker.h"
+
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+const HostAndPort kFastHost("FastHost", 27017);
+const HostAndPort kSlowHost("SlowHost", 27017);
+
+void recordLatency(HostLatencyTracker* tracker,
+                   const HostAndPort& host,
+                   Milliseconds latency,
+                   int numSamples) {
+    for (int i = 0; i < numSamples; i++) {
+        tracker->onRequestStarted(host);
+        tracker->onRequestFinished(host, latency);
+    }
+}
+
+TEST(HostLatencyTrackerTest, NoPercentileUntilEnoughSamples) {
+    HostLatencyTracker tracker;
+    ASSERT_FALSE(tracker.getLatencyPercentile(kFastHost, 90));
+
+    recordLatency(&tracker, kFastHost, Milliseconds(10), HostLatencyTracker::kMinSamples - 1);
+    ASSERT_FALSE(tracker.getLatencyPercentile(kFastHost, 90));
+
+    recordLatency(&tracker, kFastHost, Milliseconds(10), 1);
+    ASSERT(tracker.getLatencyPercentile(kFastHost, 90));
+}
+
+TEST(HostLatencyTrackerTest, RequestsWithoutLatencyAreNotSampled) {
+    HostLatencyTracker tracker;
+    for (int i = 0; i < HostLatencyTracker::kMinSamples; i++) {
+        tracker.onRequestStarted(kFastHost);
+        tracker.onRequestFinished(kFastHost, boost::none);
+    }
+
+    ASSERT_FALSE(tracker.getLatencyPercentile(kFastHost, 90));
+}
+
+TEST(HostLatencyTrackerTest, PercentilesFollowObservedLatency) {
+    HostLatencyTracker tracker;
+    recordLatency(&tracker, kFastHost, Milliseconds(10), 90);
+    recordLatency(&tracker, kFastHost, Milliseconds(200), 10);
+
+    // Percentiles are reported as the upper bound of the bucket they fall in
+    const auto p90 = *tracker.getLatencyPercentile(kFastHost, 90);
+    ASSERT_GTE(p90, Milliseconds(10));
+    ASSERT_LT(p90, Milliseconds(13));
+
+    const auto p95 = *tracker.getLatencyPercentile(kFastHost, 95);
+    ASSERT_GTE(p95, Milliseconds(200));
+    ASSERT_LT(p95, Milliseconds(250));
+}
+
+TEST(HostLatencyTrackerTest, OldSamplesDecay) {
+    HostLatencyTracker tracker;
+    recordLatency(&tracker, kFastHost, Milliseconds(100), HostLatencyTracker::kDecayThreshold);
+    ASSERT_GTE(*tracker.getLatencyPercentile(kFastHost, 95), Milliseconds(100));
+
+    recordLatency(&tracker, kFastHost, Milliseconds(1), 5 * HostLatencyTracker::kDecayThreshold);
+    ASSERT_EQ(Milliseconds(1), *tracker.getLatencyPercentile(kFastHost, 95));
+}
+
+TEST(HostLatencyTrackerTest, SelectHostsPrefersFasterHost) {
+    HostLatencyTracker tracker;
+    recordLatency(&tracker, kFastHost, Milliseconds(1), 50);
+    recordLatency(&tracker, kSlowHost, Milliseconds(100), 50);
+
+    for (int i = 0; i < 10; i++) {
+        const auto selected = tracker.selectHosts({kSlowHost, kFastHost}, 1);
+        ASSERT_EQ(1U, selected.size());
+        ASSERT_EQ(kFastHost, selected[0]);
+    }
+
+    const auto selected = tracker.selectHosts({kSlowHost, kFastHost}, 2);
+    ASSERT_EQ(2U, selected.size());
+    ASSERT_EQ(kFastHost, selected[0]);
+    ASSERT_EQ(kSlowHost, selected[1]);
+}
+
+TEST(HostLatencyTrackerTest, SelectHostsAvoidsBusyHost) {
+    HostLatencyTracker tracker;
+    recordLatency(&tracker, kFastHost, Milliseconds(10), 50);
+    recordLatency(&tracker, kSlowHost, Milliseconds(10), 50);
+
+    // Requests which are still in flight make their host less attractive
+    for (int i = 0; i < 5; i++) {
+        tracker.onRequestStarted(kSlowHost);
+    }
+
+    for (int i = 0; i < 10; i++) {
+        const auto selected = tracker.selectHosts({kSlowHost, kFastHost}, 1);
+        ASSERT_EQ(1U, selected.size());
+        ASSERT_EQ(kFastHost, selected[0]);
+    }
+}
+
+TEST(HostLatencyTrackerTest, SelectHostsWithSingleHost) {
+    HostLatencyTracker tracker;
+    const auto selected = tracker.selectHosts({kSlowHost}, 2);
+    ASSERT_EQ(1U, selected.size());
+    ASSERT_EQ(kSlowHost, selected[0]);
+}
+
+}  // namespace
+}  // namespace mongo
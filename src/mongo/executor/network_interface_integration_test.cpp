@@ -37,8 +37,11 @@
 
 #include "mongo/base/status_with.h"
 #include "mongo/client/connection_string.h"
+#include "mongo/db/service_context.h"
 #include "mongo/db/wire_version.h"
 #include "mongo/executor/connection_pool_stats.h"
+#include "mongo/executor/hedging_metrics.h"
+#include "mongo/executor/host_latency_tracker.h"
 #include "mongo/executor/network_connection_hook.h"
 #include "mongo/executor/network_interface_integration_fixture.h"
 #include "mongo/executor/test_network_connection_hook.h"
@@ -694,6 +697,110 @@ TEST_F(NetworkInterfaceInternalClientTest, StartCommandOnAny) {
     assertNumOps(0u, 0u, 0u, 1u);
 }
 
+/**
+ * Records enough commands against 'host' which took 'latency' to complete for them to outweigh
+ * the latencies recorded against it by the other tests.
+ */
+void setHostLatency(const HostAndPort& host, Milliseconds latency) {
+    auto tracker = HostLatencyTracker::get(getGlobalServiceContext());
+    for (int i = 0; i < 10 * HostLatencyTracker::kDecayThreshold; i++) {
+        tracker->onRequestStarted(host);
+        tracker->onRequestFinished(host, latency);
+    }
+}
+
+RemoteCommandRequestOnAny makeDelayedHedgeRequest(const HostAndPort& target, BSONObj cmdObj) {
+    RemoteCommandRequestBase::HedgeOptions ho;
+    ho.count = 1;
+    ho.delayPercentile = 90;
+
+    // Each target gets its own connection, so the hedge is sent to the same host on a second one.
+    return RemoteCommandRequestOnAny({target, target},
+                                     "admin",
+                                     std::move(cmdObj),
+                                     BSONObj(),
+                                     nullptr,
+                                     RemoteCommandRequest::kNoTimeout,
+                                     ho);
+}
+
+TEST_F(NetworkInterfaceInternalClientTest, DelayedHedgeIsSentOnceTheFirstRequestIsSlow) {
+    // Block "echo" for longer than its target usually takes to respond.
+    assertCommandOK("admin",
+                    BSON("configureFailPoint"
+                         << "failCommand"
+                         << "mode"
+                         << "alwaysOn"
+                         << "data"
+                         << BSON("blockConnection" << true << "blockTimeMS" << 2000
+                                                   << "failCommands" << BSON_ARRAY("echo")
+                                                   << "failInternalCommands" << true)),
+                    kNoTimeout);
+
+    ON_BLOCK_EXIT([&] {
+        // Disable blockConnection.
+        assertCommandOK("admin",
+                        BSON("configureFailPoint"
+                             << "failCommand"
+                             << "mode"
+                             << "off"),
+                        kNoTimeout);
+    });
+
+    const auto target = fixture().getServers().front();
+    setHostLatency(target, Milliseconds(500));
+
+    auto hm = HedgingMetrics::get(getGlobalServiceContext());
+    const auto numHedgedOperations = hm->getNumTotalHedgedOperations();
+
+    auto deferred =
+        runCommandOnAny(makeCallbackHandle(), makeDelayedHedgeRequest(target, makeEchoCmdObj()));
+
+    // The hedge is held back until the first request has run past the 90th percentile latency.
+    ASSERT_EQ(numHedgedOperations, hm->getNumTotalHedgedOperations());
+
+    auto res = deferred.get();
+    uassertStatusOK(res.status);
+    ASSERT_EQ(1, res.data.getIntField("ok"));
+    ASSERT_EQ(numHedgedOperations + 1, hm->getNumTotalHedgedOperations());
+}
+
+TEST_F(NetworkInterfaceInternalClientTest, DelayedHedgeIsDroppedIfTheCommandFinishesFirst) {
+    const auto target = fixture().getServers().front();
+    const Milliseconds latency{1000};
+    setHostLatency(target, latency);
+
+    auto hm = HedgingMetrics::get(getGlobalServiceContext());
+    const auto numHedgedOperations = hm->getNumTotalHedgedOperations();
+
+    auto res =
+        runCommandOnAny(makeCallbackHandle(), makeDelayedHedgeRequest(target, makeEchoCmdObj()))
+            .get();
+    uassertStatusOK(res.status);
+    ASSERT_EQ(1, res.data.getIntField("ok"));
+
+    // The connection held for the hedge is returned well before the hedge would have been due.
+    auto numConnectionsInUse = [&] {
+        ConnectionPoolStats stats;
+        net().appendConnectionStats(&stats);
+        return stats.totalInUse;
+    };
+    ClockSource::StopWatch stopwatch;
+    while (numConnectionsInUse() > 0 && stopwatch.elapsed() < latency / 2) {
+        sleepmillis(10);
+    }
+    ASSERT_EQ(0u, numConnectionsInUse());
+
+    // Wait past the time the hedge was due, so that it would have been sent by now had it not been
+    // dropped.
+    sleepFor(latency * 2);
+
+    // The hedge was never sent, so its connection was returned and no _killOperations was issued.
+    ASSERT_EQ(numHedgedOperations, hm->getNumTotalHedgedOperations());
+    ASSERT_EQ(1u, net().getCounters().sent);
+    assertNumOps(0u, 0u, 0u, 1u);
+}
+
 TEST_F(NetworkInterfaceTest, SetAlarm) {
     // set a first alarm, to execute after "expiration"
     Date_t expiration = net().now() + Milliseconds(100);
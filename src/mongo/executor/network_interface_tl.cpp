@@ -36,6 +36,7 @@
 #include "mongo/db/server_options.h"
 #include "mongo/executor/connection_pool_tl.h"
 #include "mongo/executor/hedging_metrics.h"
+#include "mongo/executor/host_latency_tracker.h"
 #include "mongo/logv2/log.h"
 #include "mongo/rpc/get_status_from_command_result.h"
 #include "mongo/transport/transport_layer_manager.h"
@@ -407,6 +408,9 @@ void NetworkInterfaceTL::CommandStateBase::tryFinish(Status status) noexcept {
         // We cancel after we issue _killOperations because, if we cancel before, existing
         // RequestStates may finish and destruct to quickly.
         requestManager->cancelRequests();
+    } else {
+        // The hedges which have not been sent yet are not needed anymore.
+        requestManager->cancelDelayedHedges();
     }
 
     networkInterfaceCommandsFailedWithErrorCode.shouldFail([&](const BSONObj& data) {
@@ -427,6 +431,12 @@ void NetworkInterfaceTL::CommandStateBase::tryFinish(Status status) noexcept {
 }
 
 void NetworkInterfaceTL::RequestState::cancel() noexcept {
+    if (hedgeTimer) {
+        // A delayed hedge which has not been sent yet returns its connection once its timer is
+        // canceled.
+        hedgeTimer->cancel(cmdState->baton);
+    }
+
     auto connToCancel = weakConn.lock();
     if (auto clientPtr = getClient(connToCancel)) {
         // If we have a client, cancel it
@@ -626,6 +636,20 @@ void NetworkInterfaceTL::RequestManager::cancelRequests() {
     }
 }
 
+void NetworkInterfaceTL::RequestManager::cancelDelayedHedges() {
+    {
+        stdx::lock_guard<Latch> lk(mutex);
+        isLocked = true;
+    }
+
+    for (size_t i = 0; i < requests.size(); i++) {
+        auto requestState = requests[i].lock();
+        if (requestState && requestState->hedgeTimer) {
+            requestState->hedgeTimer->cancel(cmdState->baton);
+        }
+    }
+}
+
 void NetworkInterfaceTL::RequestManager::killOperationsForPendingRequests() {
     {
         stdx::lock_guard<Latch> lk(mutex);
@@ -706,6 +730,8 @@ void NetworkInterfaceTL::RequestManager::trySend(
     }
 
     std::shared_ptr<RequestState> requestState;
+    Milliseconds hedgeDelay{0};
+    boost::optional<Future<void>> hedgeDue;
 
     {
         stdx::lock_guard<Latch> lk(mutex);
@@ -726,21 +752,77 @@ void NetworkInterfaceTL::RequestManager::trySend(
         requestState = std::make_shared<RequestState>(this, cmdState->shared_from_this(), idx);
         requestState->isHedge = currentSentIdx > 0;
 
+        // A hedge may be held back until the first request has been outstanding for longer than
+        // its target usually takes to respond, so that only the slow requests get hedged.
+        auto firstRequestState = requests.at(0).lock();
+        if (requestState->isHedge && firstRequestState && cmdState->interface->_svcCtx &&
+            cmdState->requestOnAny.hedgeOptions->delayPercentile) {
+            auto latency = HostLatencyTracker::get(cmdState->interface->_svcCtx)
+                               ->getLatencyPercentile(
+                                   firstRequestState->host,
+                                   *cmdState->requestOnAny.hedgeOptions->delayPercentile);
+            if (latency) {
+                hedgeDelay = *latency - firstRequestState->stopwatch.elapsed();
+            }
+        }
+
         // Set conn/weakConn+request under the lock so they will always be observed during cancel.
+        // A delayed hedge only sets its weakConn once it gets sent, so that the operation is not
+        // killed on its target if the command finishes before the hedge is due.
         requestState->conn = std::move(swConn.getValue());
-        requestState->weakConn = requestState->conn;
+        if (hedgeDelay <= Milliseconds(0)) {
+            requestState->weakConn = requestState->conn;
+        }
 
         requestState->request = RemoteCommandRequest(cmdState->requestOnAny, idx);
         requestState->host = requestState->request->target;
 
+        // The timer is armed under the lock, so that cancelling the requests always observes it.
+        if (hedgeDelay > Milliseconds(0)) {
+            requestState->hedgeTimer = cmdState->interface->_reactor->makeTimer();
+            hedgeDue = requestState->hedgeTimer->waitUntil(
+                cmdState->interface->now() + hedgeDelay, cmdState->baton);
+        }
+
         requests.at(currentSentIdx) = requestState;
     }
 
+    if (hedgeDue) {
+        LOGV2_DEBUG(5094104,
+                    2,
+                    "Delaying hedged request",
+                    "requestId"_attr = cmdState->requestOnAny.id,
+                    "target"_attr = cmdState->requestOnAny.target[idx],
+                    "delay"_attr = hedgeDelay);
+
+        std::move(*hedgeDue).getAsync([this, requestState](Status status) {
+            {
+                stdx::lock_guard<Latch> lk(mutex);
+                if (status.isOK() && !isLocked && !cmdState->finishLine.isReady()) {
+                    requestState->weakConn = requestState->conn;
+                }
+            }
+
+            if (requestState->weakConn.expired()) {
+                // The command finished before the hedge was due, so it is not needed anymore.
+                requestState->returnConnection(Status::OK());
+                return;
+            }
+
+            send(requestState);
+        });
+        return;
+    }
+
+    send(std::move(requestState));
+}
+
+void NetworkInterfaceTL::RequestManager::send(std::shared_ptr<RequestState> requestState) noexcept {
     LOGV2_DEBUG(4646300,
                 2,
                 "Sending request",
                 "requestId"_attr = cmdState->requestOnAny.id,
-                "target"_attr = cmdState->requestOnAny.target[idx]);
+                "target"_attr = requestState->host);
 
     if (requestState->isHedge) {
         auto& request = *requestState->request;
@@ -758,7 +840,7 @@ void NetworkInterfaceTL::RequestManager::trySend(
                     "Set maxTimeMS for request",
                     "maxTime"_attr = Milliseconds(maxTimeMS),
                     "requestId"_attr = cmdState->requestOnAny.id,
-                    "target"_attr = cmdState->requestOnAny.target[idx]);
+                    "target"_attr = requestState->host);
 
         if (cmdState->interface->_svcCtx) {
             auto hm = HedgingMetrics::get(cmdState->interface->_svcCtx);
@@ -780,6 +862,10 @@ void NetworkInterfaceTL::RequestManager::trySend(
         counters->recordSent();
     }
 
+    if (cmdState->requestOnAny.trackHostLatency && cmdState->interface->_svcCtx) {
+        HostLatencyTracker::get(cmdState->interface->_svcCtx)->onRequestStarted(requestState->host);
+    }
+
     requestState->resolve(cmdState->sendRequest(requestState));
 }
 
@@ -808,6 +894,15 @@ void NetworkInterfaceTL::RequestState::resolve(Future<RemoteCommandResponse> fut
             returnConnection(status);
 
             auto commandStatus = getStatusFromCommandResult(response.data);
+
+            if (cmdState->requestOnAny.trackHostLatency && interface()->_svcCtx) {
+                // Only the requests which ran to completion on their target tell how fast it is
+                const bool ranToCompletion =
+                    status.isOK() && commandStatus != ErrorCodes::MaxTimeMSExpired;
+                HostLatencyTracker::get(interface()->_svcCtx)
+                    ->onRequestFinished(host,
+                                        ranToCompletion ? response.elapsedMillis : boost::none);
+            }
             // Ignore maxTimeMS expiration errors for hedged reads without triggering the finish
             // line.
             if (isHedge && commandStatus == ErrorCodes::MaxTimeMSExpired) {
@@ -233,9 +233,20 @@ private:
         RequestManager(CommandStateBase* cmdState);
 
         void trySend(StatusWith<ConnectionPool::ConnectionHandle> swConn, size_t idx) noexcept;
+
+        /**
+         * Sends out a request which has acquired a connection.
+         */
+        void send(std::shared_ptr<RequestState> requestState) noexcept;
         void cancelRequests();
         void killOperationsForPendingRequests();
 
+        /**
+         * Drops the hedged requests which are still waiting to be sent, so that their connections
+         * are returned right away.
+         */
+        void cancelDelayedHedges();
+
         CommandStateBase* cmdState;
         std::vector<std::weak_ptr<RequestState>> requests;
 
@@ -302,6 +313,10 @@ private:
         // True if this request is an additional request sent to hedge the operation.
         bool isHedge{false};
 
+        // Set if this hedged request is waiting for the first request to take longer than its
+        // target usually does before it gets sent.
+        std::unique_ptr<transport::ReactorTimer> hedgeTimer;
+
         // Set to true if the response to the request is used to fulfill the command's
         // promise (i.e. arrives before the responses to all other requests and is not
         // a MaxTimeMSExpired error response if this is a hedged request).
@@ -46,6 +46,9 @@ struct RemoteCommandRequestBase {
     struct HedgeOptions {
         size_t count = 0;
         int maxTimeMSForHedgedReads = 0;
+        // If set, the additional requests are only sent once the first one has been outstanding
+        // for longer than this percentile of its target's recently observed latency.
+        boost::optional<double> delayPercentile;
     };
 
     enum FireAndForgetMode { kOn, kOff };
@@ -88,6 +91,10 @@ struct RemoteCommandRequestBase {
 
     FireAndForgetMode fireAndForgetMode;
 
+    // Whether the latency of this request should be recorded against its target in the
+    // HostLatencyTracker.
+    bool trackHostLatency = false;
+
     Milliseconds timeout = kNoTimeout;
 
     // Time when the request was scheduled.
@@ -37,6 +37,7 @@
 #include <memory>
 
 #include "mongo/client/remote_command_targeter.h"
+#include "mongo/executor/host_latency_tracker.h"
 #include "mongo/executor/remote_command_request.h"
 #include "mongo/logv2/log.h"
 #include "mongo/rpc/get_status_from_command_result.h"
@@ -176,6 +177,15 @@ auto AsyncRequestsSender::RemoteData::scheduleRequest()
     return resolveShardIdToHostAndPorts(_ars->_readPreference)
         .thenRunOn(*_ars->_subBaton)
         .then([this](auto&& hostAndPorts) {
+            if (isLatencyAwareReadHostSelectionEnabled(_cmdObj, _ars->_readPreference)) {
+                // Only keep the hosts the request may be sent to, the first of them being the one
+                // expected to respond fastest
+                const auto hedgeOptions = extractHedgeOptions(_cmdObj, _ars->_readPreference);
+                hostAndPorts =
+                    HostLatencyTracker::get(_ars->_opCtx->getServiceContext())
+                        ->selectHosts(hostAndPorts, hedgeOptions ? hedgeOptions->count + 1 : 1);
+            }
+
             _shardHostAndPort.emplace(hostAndPorts.front());
             return scheduleRemoteCommand(std::move(hostAndPorts));
         })
@@ -218,6 +228,8 @@ auto AsyncRequestsSender::RemoteData::scheduleRemoteCommand(std::vector<HostAndP
                                                 _ars->_metadataObj,
                                                 _ars->_opCtx,
                                                 hedgeOptions);
+    request.trackHostLatency =
+        isLatencyAwareReadHostSelectionEnabled(_cmdObj, _ars->_readPreference);
 
     // We have to make a promise future pair because the TaskExecutor doesn't currently support a
     // future returning variant of scheduleRemoteCommand
@@ -533,6 +533,35 @@ void CatalogCache::purgeAllDatabases() {
     _collectionsByDb.clear();
 }
 
+std::vector<std::shared_ptr<RoutingTableHistory>> CatalogCache::getCachedRoutingTables() const {
+    std::vector<std::shared_ptr<RoutingTableHistory>> routingTables;
+
+    stdx::lock_guard<Latch> lg(_mutex);
+    for (const auto& [db, collInfoMap] : _collectionsByDb) {
+        for (const auto& [collNs, collRoutingInfoEntry] : collInfoMap) {
+            if (!collRoutingInfoEntry->needsRefresh && collRoutingInfoEntry->routingInfo) {
+                routingTables.push_back(collRoutingInfoEntry->routingInfo);
+            }
+        }
+    }
+
+    return routingTables;
+}
+
+void CatalogCache::seedCollectionRoutingInfo(std::shared_ptr<RoutingTableHistory> routingInfo) {
+    invariant(routingInfo);
+
+    stdx::lock_guard<Latch> lg(_mutex);
+    auto collRoutingInfoEntry = _createOrGetCollectionEntry(lg, routingInfo->getns());
+    if (collRoutingInfoEntry->routingInfo || collRoutingInfoEntry->refreshCompletionNotification) {
+        return;
+    }
+
+    collRoutingInfoEntry->needsRefresh = true;
+    collRoutingInfoEntry->epochHasChanged = true;
+    collRoutingInfoEntry->routingInfo = std::move(routingInfo);
+}
+
 void CatalogCache::report(BSONObjBuilder* builder) const {
     BSONObjBuilder cacheStatsBuilder(builder->subobjStart("catalogCache"));
 
@@ -291,6 +291,20 @@ public:
      */
     void purgeAllDatabases();
 
+    /**
+     * Returns the routing tables of all sharded collections whose cached entries do not need a
+     * refresh. Used to persist the routing table cache across restarts.
+     */
+    std::vector<std::shared_ptr<RoutingTableHistory>> getCachedRoutingTables() const;
+
+    /**
+     * Non-blocking method, which installs 'routingInfo' as the cached routing table for its
+     * namespace, unless the namespace already has one, and marks the entry as needing refresh. The
+     * next access to the namespace will block on a refresh which only fetches the chunks changed
+     * since the version of 'routingInfo', or reloads them all if the epoch no longer matches.
+     */
+    void seedCollectionRoutingInfo(std::shared_ptr<RoutingTableHistory> routingInfo);
+
     /**
      * Reports statistics about the catalog cache to be used by serverStatus
      */
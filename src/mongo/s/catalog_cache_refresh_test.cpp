@@ -39,6 +39,7 @@
 #include "mongo/s/catalog_cache.h"
 #include "mongo/s/catalog_cache_test_fixture.h"
 #include "mongo/s/database_version_helpers.h"
+#include "mongo/s/grid.h"
 #include "mongo/unittest/death_test.h"
 
 namespace mongo {
@@ -866,5 +867,61 @@ TEST_F(CatalogCacheRefreshTest, IncrementalLoadAfterMoveLastChunk) {
     ASSERT_EQ(version, cm->getVersion({"1"}));
 }
 
+TEST_F(CatalogCacheRefreshTest, IncrementalLoadAfterSeedingRoutingTable) {
+    const ShardKeyPattern shardKeyPattern(BSON("_id" << 1));
+
+    ChunkVersion version(1, 0, OID::gen());
+
+    ChunkType initialChunk(kNss,
+                           {shardKeyPattern.getKeyPattern().globalMin(),
+                            shardKeyPattern.getKeyPattern().globalMax()},
+                           version,
+                           {"0"});
+    Grid::get(getServiceContext())
+        ->catalogCache()
+        ->seedCollectionRoutingInfo(RoutingTableHistory::makeNew(kNss,
+                                                                 boost::none,
+                                                                 shardKeyPattern.getKeyPattern(),
+                                                                 nullptr,
+                                                                 false,
+                                                                 version.epoch(),
+                                                                 {initialChunk}));
+
+    auto future = scheduleRoutingInfoUnforcedRefresh(kNss);
+
+    expectGetDatabase();
+    expectGetCollection(version.epoch(), shardKeyPattern);
+
+    // Return set of chunks, which represent a split done since the routing table was seeded
+    onFindCommand([&](const RemoteCommandRequest& request) {
+        // Ensure it is a differential query starting from the seeded version
+        const auto diffQuery =
+            assertGet(QueryRequest::makeFromFindCommand(kNss, request.cmdObj, false));
+        ASSERT_BSONOBJ_EQ(
+            BSON("ns" << kNss.ns() << "lastmod"
+                      << BSON("$gte" << Timestamp(version.majorVersion(), version.minorVersion()))),
+            diffQuery->getFilter());
+
+        version.incMajor();
+        ChunkType chunk1(
+            kNss, {shardKeyPattern.getKeyPattern().globalMin(), BSON("_id" << 0)}, version, {"0"});
+        chunk1.setName(OID::gen());
+
+        version.incMinor();
+        ChunkType chunk2(
+            kNss, {BSON("_id" << 0), shardKeyPattern.getKeyPattern().globalMax()}, version, {"0"});
+        chunk2.setName(OID::gen());
+
+        return std::vector<BSONObj>{chunk1.toConfigBSON(), chunk2.toConfigBSON()};
+    });
+
+    auto routingInfo = future.default_timed_get();
+    ASSERT(routingInfo->cm());
+    auto cm = routingInfo->cm();
+
+    ASSERT_EQ(2, cm->numChunks());
+    ASSERT_EQ(version, cm->getVersion());
+}
+
 }  // namespace
 }  // namespace mongo
@@ -0,0 +1,332 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/s/catalog_cache_snapshot.h"
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+
+#include "mongo/base/data_range_cursor.h"
+#include "mongo/base/data_type_validated.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/util/bson_extract.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/query/collation/collator_factory_interface.h"
+#include "mongo/rpc/object_check.h"
+#include "mongo/s/catalog/type_chunk.h"
+#include "mongo/s/catalog_cache.h"
+#include "mongo/s/chunk_manager.h"
+#include "mongo/util/scopeguard.h"
+#include "mongo/util/str.h"
+
+namespace mongo {
+namespace {
+
+// Bumped whenever the layout of the snapshot file changes, so that a router never seeds its cache
+// from a file written by a different version
+const int kSnapshotFormatVersion = 1;
+
+constexpr StringData kFormatVersionField = "formatVersion"_sd;
+constexpr StringData kNsField = "ns"_sd;
+constexpr StringData kUUIDField = "uuid"_sd;
+constexpr StringData kEpochField = "epoch"_sd;
+constexpr StringData kKeyField = "key"_sd;
+constexpr StringData kUniqueField = "unique"_sd;
+constexpr StringData kDefaultCollationField = "defaultCollation"_sd;
+constexpr StringData kNumChunksField = "numChunks"_sd;
+
+Status writeDocument(std::ofstream& stream, const BSONObj& obj, const std::string& path) {
+    stream.write(obj.objdata(), obj.objsize());
+    if (stream.fail()) {
+        return {ErrorCodes::FileStreamFailed,
+                str::stream() << "Failed to write to routing table cache snapshot file \"" << path
+                              << "\""};
+    }
+
+    return Status::OK();
+}
+
+/**
+ * Reads the next BSON document from 'stream' into 'buffer'. Returns an empty document once the end
+ * of the file has been reached.
+ */
+StatusWith<BSONObj> readDocument(std::ifstream& stream,
+                                 std::vector<char>* buffer,
+                                 const std::string& path) {
+    char buf[sizeof(std::int32_t)];
+
+    stream.read(buf, sizeof(buf));
+    if (sizeof(buf) != stream.gcount()) {
+        if (0 == stream.gcount() && stream.eof()) {
+            return BSONObj();
+        }
+
+        return {ErrorCodes::FileStreamFailed,
+                str::stream() << "Failed to read 4 bytes from file \"" << path << "\""};
+    }
+
+    const std::int32_t bsonLength = ConstDataView(buf).read<LittleEndian<std::int32_t>>();
+    if (bsonLength < BSONObj::kMinBSONLength || bsonLength > BSONObjMaxInternalSize) {
+        return {ErrorCodes::InvalidLength,
+                str::stream() << "Invalid BSON length found in file \"" << path << "\""};
+    }
+
+    buffer->resize(bsonLength);
+    memcpy(buffer->data(), buf, sizeof(std::int32_t));
+
+    const std::int32_t readSize = bsonLength - sizeof(std::int32_t);
+    stream.read(buffer->data() + sizeof(std::int32_t), readSize);
+    if (readSize != stream.gcount()) {
+        return {ErrorCodes::FileStreamFailed,
+                str::stream() << "Failed to read " << readSize << " bytes from file \"" << path
+                              << "\""};
+    }
+
+    ConstDataRange cdr(buffer->data(), buffer->data() + bsonLength);
+    auto swObj = cdr.readNoThrow<Validated<BSONObj>>();
+    if (!swObj.isOK()) {
+        return swObj.getStatus();
+    }
+
+    return swObj.getValue().val.getOwned();
+}
+
+BSONObj readNextDocument(std::ifstream& stream,
+                         std::vector<char>* buffer,
+                         const std::string& path) {
+    auto obj = uassertStatusOK(readDocument(stream, buffer, path));
+    uassert(ErrorCodes::FileStreamFailed,
+            str::stream() << "Routing table cache snapshot file \"" << path << "\" is truncated",
+            !obj.isEmpty());
+    return obj;
+}
+
+/**
+ * Reads the description of a single collection and all of its chunks and builds the corresponding
+ * routing table from them. 'fileSize' bounds the number of chunks the collection can claim to have.
+ */
+std::shared_ptr<RoutingTableHistory> readRoutingTable(OperationContext* opCtx,
+                                                      const BSONObj& collDoc,
+                                                      std::ifstream& stream,
+                                                      std::vector<char>* buffer,
+                                                      const std::string& path,
+                                                      std::uintmax_t fileSize) {
+    std::string ns;
+    uassertStatusOK(bsonExtractStringField(collDoc, kNsField, &ns));
+    const NamespaceString nss(ns);
+
+    boost::optional<UUID> uuid;
+    if (auto uuidElem = collDoc[kUUIDField]) {
+        uuid = uassertStatusOK(UUID::parse(uuidElem));
+    }
+
+    OID epoch;
+    uassertStatusOK(bsonExtractOIDField(collDoc, kEpochField, &epoch));
+
+    BSONElement keyElem;
+    uassertStatusOK(bsonExtractTypedField(collDoc, kKeyField, Object, &keyElem));
+
+    bool unique;
+    uassertStatusOK(bsonExtractBooleanField(collDoc, kUniqueField, &unique));
+
+    std::unique_ptr<CollatorInterface> defaultCollator;
+    if (auto collationElem = collDoc[kDefaultCollationField]) {
+        defaultCollator = uassertStatusOK(CollatorFactoryInterface::get(opCtx->getServiceContext())
+                                              ->makeFromBSON(collationElem.Obj()));
+    }
+
+    long long numChunks;
+    uassertStatusOK(bsonExtractIntegerField(collDoc, kNumChunksField, &numChunks));
+
+    // Every chunk takes up at least one BSON document in the file, so a larger count can only come
+    // from a corrupt file and must not be used to size the chunks vector
+    uassert(ErrorCodes::InvalidLength,
+            str::stream() << "Invalid number of chunks " << numChunks << " for collection " << nss
+                          << " in routing table cache snapshot file \"" << path << "\"",
+            numChunks >= 0 &&
+                static_cast<std::uintmax_t>(numChunks) <= fileSize / BSONObj::kMinBSONLength);
+
+    std::vector<ChunkType> chunks;
+    chunks.reserve(numChunks);
+    for (long long i = 0; i < numChunks; i++) {
+        auto chunk = uassertStatusOK(
+            ChunkType::fromShardBSON(readNextDocument(stream, buffer, path), epoch));
+        chunk.setNS(nss);
+        chunks.push_back(std::move(chunk));
+    }
+
+    return RoutingTableHistory::makeNew(nss,
+                                        uuid,
+                                        KeyPattern(keyElem.Obj().getOwned()),
+                                        std::move(defaultCollator),
+                                        unique,
+                                        epoch,
+                                        chunks);
+}
+
+}  // namespace
+
+Status writeCatalogCacheSnapshot(CatalogCache* catalogCache, const std::string& path) {
+    const auto routingTables = catalogCache->getCachedRoutingTables();
+
+    const boost::filesystem::path file(path);
+    const boost::filesystem::path tempFile(path + ".tmp");
+
+    // Never leave a partially written snapshot behind if writing it fails
+    auto removeTempFile = makeGuard([&] {
+        boost::system::error_code ec;
+        boost::filesystem::remove(tempFile, ec);
+    });
+
+    std::ofstream stream;
+    stream.open(tempFile.c_str(),
+                std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    if (!stream.is_open()) {
+        return {ErrorCodes::FileNotOpen,
+                str::stream() << "Failed to open routing table cache snapshot file \""
+                              << tempFile.generic_string() << "\""};
+    }
+
+    Status status =
+        writeDocument(stream, BSON(kFormatVersionField << kSnapshotFormatVersion), path);
+    if (!status.isOK()) {
+        return status;
+    }
+
+    for (const auto& rt : routingTables) {
+        BSONObjBuilder collBuilder;
+        collBuilder.append(kNsField, rt->getns().ns());
+        if (auto uuid = rt->getUUID()) {
+            uuid->appendToBuilder(&collBuilder, kUUIDField);
+        }
+        collBuilder.append(kEpochField, rt->getVersion().epoch());
+        collBuilder.append(kKeyField, rt->getShardKeyPattern().toBSON());
+        collBuilder.append(kUniqueField, rt->isUnique());
+        if (auto defaultCollator = rt->getDefaultCollator()) {
+            collBuilder.append(kDefaultCollationField, defaultCollator->getSpec().toBSON());
+        }
+        collBuilder.append(kNumChunksField, static_cast<long long>(rt->numChunks()));
+
+        status = writeDocument(stream, collBuilder.obj(), path);
+        if (!status.isOK()) {
+            return status;
+        }
+
+        rt->forEachChunk([&](const std::shared_ptr<ChunkInfo>& chunkInfo) {
+            ChunkType chunk(rt->getns(),
+                            chunkInfo->getRange(),
+                            chunkInfo->getLastmod(),
+                            chunkInfo->getShardIdAt(boost::none));
+            chunk.setHistory(chunkInfo->getHistory());
+
+            status = writeDocument(stream, chunk.toShardBSON(), path);
+            return status.isOK();
+        });
+        if (!status.isOK()) {
+            return status;
+        }
+    }
+
+    stream.close();
+    if (stream.fail()) {
+        return {ErrorCodes::FileStreamFailed,
+                str::stream() << "Failed to close routing table cache snapshot file \""
+                              << tempFile.generic_string() << "\""};
+    }
+
+    // Only make the snapshot visible once it has been written completely, so that a crash while
+    // writing it never leaves behind a file with missing chunks
+    boost::system::error_code ec;
+    boost::filesystem::rename(tempFile, file, ec);
+    if (ec) {
+        return Status(ErrorCodes::FileRenameFailed, ec.message());
+    }
+
+    removeTempFile.dismiss();
+    return Status::OK();
+}
+
+StatusWith<size_t> loadCatalogCacheSnapshot(OperationContext* opCtx,
+                                            CatalogCache* catalogCache,
+                                            const std::string& path) {
+    if (!boost::filesystem::exists(path)) {
+        return 0;
+    }
+
+    boost::system::error_code ec;
+    const auto fileSize = boost::filesystem::file_size(path, ec);
+    if (ec) {
+        return {ErrorCodes::FileStreamFailed,
+                str::stream() << "Failed to get the size of routing table cache snapshot file \""
+                              << path << "\": " << ec.message()};
+    }
+
+    std::ifstream stream;
+    stream.open(path.c_str(), std::ios_base::in | std::ios_base::binary);
+    if (!stream.is_open()) {
+        return {ErrorCodes::FileNotOpen,
+                str::stream() << "Failed to open routing table cache snapshot file \"" << path
+                              << "\""};
+    }
+
+    std::vector<std::shared_ptr<RoutingTableHistory>> routingTables;
+    try {
+        std::vector<char> buffer;
+
+        const auto header = readNextDocument(stream, &buffer, path);
+        uassert(ErrorCodes::UnsupportedFormat,
+                str::stream() << "Routing table cache snapshot file \"" << path
+                              << "\" has an unsupported format " << header,
+                header[kFormatVersionField].numberInt() == kSnapshotFormatVersion);
+
+        while (true) {
+            const auto collDoc = uassertStatusOK(readDocument(stream, &buffer, path));
+            if (collDoc.isEmpty()) {
+                break;
+            }
+
+            routingTables.push_back(
+                readRoutingTable(opCtx, collDoc, stream, &buffer, path, fileSize));
+        }
+    } catch (const DBException& ex) {
+        return ex.toStatus();
+    }
+
+    // Only seed the cache once the entire file has been read successfully, so that a corrupt
+    // snapshot is ignored as a whole
+    for (auto& rt : routingTables) {
+        catalogCache->seedCollectionRoutingInfo(std::move(rt));
+    }
+
+    return routingTables.size();
+}
+
+}  // namespace mongo
@@ -0,0 +1,67 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "mongo/base/status.h"
+#include "mongo/base/status_with.h"
+
+namespace mongo {
+
+class CatalogCache;
+class OperationContext;
+
+/**
+ * Persists the routing tables of the sharded collections cached by 'catalogCache' to the file at
+ * 'path', so that a restarted router can seed its cache from it instead of loading every chunk
+ * from the config server again. The file is written under a temporary name and renamed into place
+ * once complete.
+ *
+ * The file is a sequence of BSON documents: a header identifying the format, followed for each
+ * collection by a document describing the collection and its chunks in the format used by the
+ * shard servers' persisted routing table cache.
+ */
+Status writeCatalogCacheSnapshot(CatalogCache* catalogCache, const std::string& path);
+
+/**
+ * Loads the routing tables persisted by writeCatalogCacheSnapshot and seeds 'catalogCache' with
+ * them. The seeded tables are not trusted as they are: the first access to each namespace refreshes
+ * it from the persisted collection version, which only fetches the chunks that changed since, or
+ * reloads the collection from scratch if its epoch no longer matches.
+ *
+ * Returns the number of collections loaded, which is zero if no snapshot has been written yet.
+ */
+StatusWith<size_t> loadCatalogCacheSnapshot(OperationContext* opCtx,
+                                            CatalogCache* catalogCache,
+                                            const std::string& path);
+
+}  // namespace mongo
@@ -0,0 +1,204 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <limits>
+
+#include "mongo/db/query/query_request.h"
+#include "mongo/s/catalog/type_chunk.h"
+#include "mongo/s/catalog_cache.h"
+#include "mongo/s/catalog_cache_snapshot.h"
+#include "mongo/s/catalog_cache_test_fixture.h"
+#include "mongo/s/chunk_manager.h"
+#include "mongo/s/grid.h"
+#include "mongo/unittest/temp_dir.h"
+
+namespace mongo {
+namespace {
+
+using executor::RemoteCommandRequest;
+using unittest::assertGet;
+
+const NamespaceString kNss("TestDB", "TestColl");
+
+class CatalogCacheSnapshotTest : public CatalogCacheTestFixture {
+protected:
+    void setUp() override {
+        CatalogCacheTestFixture::setUp();
+
+        _path = _tempDir.path() + "/routingTableCache";
+    }
+
+    CatalogCache* getCatalogCache() {
+        return Grid::get(getServiceContext())->catalogCache();
+    }
+
+    /**
+     * Caches a routing table for 'kNss' with three chunks and writes a snapshot of the cache.
+     */
+    std::shared_ptr<ChunkManager> writeSnapshot() {
+        auto cm = makeChunkManager(kNss,
+                                   ShardKeyPattern(BSON("_id" << 1)),
+                                   nullptr,
+                                   false,
+                                   {BSON("_id" << 0), BSON("_id" << 10)});
+        ASSERT_OK(writeCatalogCacheSnapshot(getCatalogCache(), _path));
+        return cm;
+    }
+
+    /**
+     * Overwrites the snapshot file with 'docs' written back to back.
+     */
+    void writeDocuments(const std::vector<BSONObj>& docs) {
+        std::ofstream stream(_path, std::ios_base::out | std::ios_base::binary);
+        for (const auto& doc : docs) {
+            stream.write(doc.objdata(), doc.objsize());
+        }
+        ASSERT(stream.good());
+    }
+
+    /**
+     * Purges the catalog cache and loads the snapshot into it, expecting the load to fail with
+     * 'expectedCode' and the cache to be left as it was.
+     */
+    void assertSnapshotIgnored(ErrorCodes::Error expectedCode,
+                               const std::shared_ptr<ChunkManager>& cm) {
+        getCatalogCache()->purgeAllDatabases();
+        ASSERT_EQ(expectedCode,
+                  loadCatalogCacheSnapshot(operationContext(), getCatalogCache(), _path)
+                      .getStatus()
+                      .code());
+
+        // Nothing was seeded, so the next access to the collection loads all of its chunks
+        auto newCm = refreshFrom(*cm, ChunkVersion(0, 0, cm->getVersion().epoch()));
+        ASSERT_EQ(cm->numChunks(), newCm->numChunks());
+        ASSERT_EQ(cm->getVersion(), newCm->getVersion());
+    }
+
+    /**
+     * Refreshes 'kNss', expecting its chunks to be fetched starting at 'sinceVersion', and
+     * responds with the chunks of 'cm' which are at that version or newer.
+     */
+    std::shared_ptr<ChunkManager> refreshFrom(const ChunkManager& cm,
+                                              const ChunkVersion& sinceVersion) {
+        auto future = scheduleRoutingInfoUnforcedRefresh(kNss);
+
+        expectGetDatabase(kNss);
+        expectGetCollection(kNss, cm.getVersion().epoch(), cm.getShardKeyPattern());
+        onFindCommand([&](const RemoteCommandRequest& request) {
+            const auto diffQuery =
+                assertGet(QueryRequest::makeFromFindCommand(kNss, request.cmdObj, false));
+            ASSERT_BSONOBJ_EQ(BSON("ns" << kNss.ns() << "lastmod"
+                                        << BSON("$gte" << Timestamp(sinceVersion.toLong()))),
+                              diffQuery->getFilter());
+
+            std::vector<BSONObj> chunks;
+            cm.forEachChunk([&](const Chunk& chunk) {
+                if (chunk.getLastmod().toLong() >= sinceVersion.toLong()) {
+                    ChunkType chunkType(kNss,
+                                        {chunk.getMin(), chunk.getMax()},
+                                        chunk.getLastmod(),
+                                        chunk.getShardId());
+                    chunkType.setName(OID::gen());
+                    chunks.push_back(chunkType.toConfigBSON());
+                }
+                return true;
+            });
+            return chunks;
+        });
+
+        auto routingInfo = future.default_timed_get();
+        ASSERT(routingInfo->cm());
+        return routingInfo->cm();
+    }
+
+    unittest::TempDir _tempDir{"CatalogCacheSnapshotTest"};
+    std::string _path;
+};
+
+TEST_F(CatalogCacheSnapshotTest, WriteAndLoadRoundTrip) {
+    auto cm = writeSnapshot();
+    ASSERT(boost::filesystem::exists(_path));
+    ASSERT_FALSE(boost::filesystem::exists(_path + ".tmp"));
+
+    getCatalogCache()->purgeAllDatabases();
+    ASSERT_EQ(1U,
+              assertGet(loadCatalogCacheSnapshot(operationContext(), getCatalogCache(), _path)));
+
+    // The seeded routing table is refreshed incrementally, starting at its persisted version
+    auto newCm = refreshFrom(*cm, cm->getVersion());
+    ASSERT_EQ(cm->numChunks(), newCm->numChunks());
+    ASSERT_EQ(cm->getVersion(), newCm->getVersion());
+}
+
+TEST_F(CatalogCacheSnapshotTest, LoadWithoutSnapshotFile) {
+    ASSERT_EQ(0U,
+              assertGet(loadCatalogCacheSnapshot(operationContext(), getCatalogCache(), _path)));
+}
+
+TEST_F(CatalogCacheSnapshotTest, TruncatedSnapshotIsIgnored) {
+    auto cm = writeSnapshot();
+    boost::filesystem::resize_file(_path, boost::filesystem::file_size(_path) - 1);
+
+    assertSnapshotIgnored(ErrorCodes::FileStreamFailed, cm);
+}
+
+TEST_F(CatalogCacheSnapshotTest, SnapshotWithUnsupportedFormatVersionIsIgnored) {
+    auto cm = writeSnapshot();
+    writeDocuments({BSON("formatVersion" << 2)});
+
+    assertSnapshotIgnored(ErrorCodes::UnsupportedFormat, cm);
+}
+
+TEST_F(CatalogCacheSnapshotTest, SnapshotWithInvalidDocumentLengthIsIgnored) {
+    auto cm = writeSnapshot();
+    writeDocuments({BSON("formatVersion" << 1)});
+    {
+        std::ofstream stream(_path, std::ios_base::out | std::ios_base::app);
+        stream << "corrupt";
+    }
+
+    assertSnapshotIgnored(ErrorCodes::InvalidLength, cm);
+}
+
+TEST_F(CatalogCacheSnapshotTest, SnapshotWithInvalidNumberOfChunksIsIgnored) {
+    auto cm = writeSnapshot();
+    writeDocuments({BSON("formatVersion" << 1),
+                    BSON("ns" << kNss.ns() << "epoch" << cm->getVersion().epoch() << "key"
+                              << BSON("_id" << 1) << "unique" << false << "numChunks"
+                              << std::numeric_limits<long long>::max())});
+
+    assertSnapshotIgnored(ErrorCodes::InvalidLength, cm);
+}
+
+}  // namespace
+}  // namespace mongo
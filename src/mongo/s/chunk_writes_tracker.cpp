@@ -48,7 +48,15 @@ bool ChunkWritesTracker::shouldSplit(uint64_t maxChunkSize) {
     }
 
     // Check if there are enough estimated bytes written to warrant a split
-    return getBytesWritten() > maxChunkSize / ChunkWritesTracker::kSplitTestFactor;
+    const auto bytesWritten = getBytesWritten();
+    if (bytesWritten <= maxChunkSize / ChunkWritesTracker::kSplitTestFactor) {
+        return false;
+    }
+
+    // Writes include updates and deletes, which do not grow the chunk, so the measured size plus
+    // the bytes written since is only an upper bound
+    const auto measuredChunkSize = _measuredChunkSizeBytes.loadRelaxed();
+    return measuredChunkSize == 0 || measuredChunkSize + bytesWritten >= maxChunkSize / 2;
 }
 
 bool ChunkWritesTracker::acquireSplitLock() {
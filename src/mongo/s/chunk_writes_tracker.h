@@ -62,9 +62,20 @@ public:
      */
     uint64_t clearBytesWritten();
 
+    /**
+     * Records the size of the chunk as measured by a split attempt which found no split points.
+     * The bytes written from then on are counted on top of it, which gives an upper bound of the
+     * current size of the chunk.
+     */
+    void setMeasuredChunkSize(uint64_t chunkSizeBytes) {
+        _measuredChunkSizeBytes.store(chunkSizeBytes);
+    }
+
     /**
      * Returns whether or not this chunk is ready to be split based on the
-     * maximum allowable size of a chunk.
+     * maximum allowable size of a chunk. Once the size of the chunk has been measured, this
+     * also requires that the chunk may have grown to at least half of the maximum size, since
+     * looking for split points in a smaller chunk would not find any.
      */
     bool shouldSplit(uint64_t maxChunkSize);
 
@@ -86,6 +97,12 @@ private:
      */
     AtomicWord<unsigned long long> _bytesWritten{0};
 
+    /**
+     * The size of the chunk as of the last split attempt which found no split points, or zero if
+     * it has not been measured.
+     */
+    AtomicWord<unsigned long long> _measuredChunkSizeBytes{0};
+
     /**
      * Protects _splitState when starting a split.
      */
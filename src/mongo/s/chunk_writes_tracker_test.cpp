@@ -112,6 +112,24 @@ TEST(ChunkWritesTrackerTest, ShouldSplitReturnsFalseWithBytesWrittenGreaterThanT
     ASSERT_TRUE(wt.shouldSplit(maxChunkSize));
 }
 
+TEST(ChunkWritesTrackerTest, ShouldSplitWaitsForMeasuredChunkToReachHalfMaxChunkSize) {
+    ChunkWritesTracker wt;
+    uint64_t maxChunkSize{100};
+    wt.setMeasuredChunkSize(20ull);
+    wt.addBytesWritten(maxChunkSize / ChunkWritesTracker::kSplitTestFactor + 1);
+    ASSERT_FALSE(wt.shouldSplit(maxChunkSize));
+    wt.addBytesWritten(maxChunkSize / 2 - 20 - wt.getBytesWritten());
+    ASSERT_TRUE(wt.shouldSplit(maxChunkSize));
+}
+
+TEST(ChunkWritesTrackerTest, ShouldSplitIgnoresMeasuredChunkSizeBelowWriteThreshold) {
+    ChunkWritesTracker wt;
+    uint64_t maxChunkSize{100};
+    wt.setMeasuredChunkSize(maxChunkSize);
+    wt.addBytesWritten(maxChunkSize / ChunkWritesTracker::kSplitTestFactor);
+    ASSERT_FALSE(wt.shouldSplit(maxChunkSize));
+}
+
 TEST(ChunkWritesTrackerTest, ShouldSplitReturnsFalseWhenSplitLockAcquired) {
     ChunkWritesTracker wt;
     wt.addBytesWritten(4ull);
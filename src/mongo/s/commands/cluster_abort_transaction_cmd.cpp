@@ -34,7 +34,9 @@
 #include "mongo/db/commands.h"
 #include "mongo/db/transaction_validation.h"
 #include "mongo/s/cluster_commands_helpers.h"
+#include "mongo/s/query/cluster_find_result_cache.h"
 #include "mongo/s/transaction_router.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo {
 namespace {
@@ -94,6 +96,7 @@ public:
                 "abortTransaction can only be run within a session",
                 txnRouter);
 
+        ON_BLOCK_EXIT([&] { ClusterFindResultCache::get(opCtx)->onTransactionEnd(opCtx); });
         auto abortRes = txnRouter.abortTransaction(opCtx);
         CommandHelpers::filterCommandReplyForPassthrough(abortRes, &result);
         return true;
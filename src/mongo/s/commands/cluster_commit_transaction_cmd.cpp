@@ -34,7 +34,9 @@
 #include "mongo/db/commands.h"
 #include "mongo/db/commands/txn_cmds_gen.h"
 #include "mongo/s/cluster_commands_helpers.h"
+#include "mongo/s/query/cluster_find_result_cache.h"
 #include "mongo/s/transaction_router.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo {
 namespace {
@@ -79,6 +81,7 @@ public:
 
         const auto commitCmd =
             CommitTransaction::parse(IDLParserErrorContext("commit cmd"), cmdObj);
+        ON_BLOCK_EXIT([&] { ClusterFindResultCache::get(opCtx)->onTransactionEnd(opCtx); });
         auto commitRes = txnRouter.commitTransaction(opCtx, commitCmd.getRecoveryToken());
         CommandHelpers::filterCommandReplyForPassthrough(commitRes, &result);
         return true;
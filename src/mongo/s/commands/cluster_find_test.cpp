@@ -30,7 +30,11 @@
 #include "mongo/platform/basic.h"
 
 #include "mongo/db/query/cursor_response.h"
+#include "mongo/rpc/get_status_from_command_result.h"
+#include "mongo/rpc/op_msg.h"
 #include "mongo/s/commands/cluster_command_test_fixture.h"
+#include "mongo/s/query/cluster_find_result_cache.h"
+#include "mongo/util/clock_source_mock.h"
 
 namespace mongo {
 namespace {
@@ -99,5 +103,91 @@ TEST_F(ClusterFindTest, SnapshotReadConcernWithAfterClusterTime) {
     testSnapshotReadConcernWithAfterClusterTime(kFindCmdTargeted, kFindCmdScatterGather);
 }
 
+class ClusterFindResultCacheTest : public ClusterFindTest {
+protected:
+    // Read concern is given explicitly so that no default read concern needs to be looked up.
+    const BSONObj kLocalFindCmdScatterGather = BSON("find"
+                                                    << "coll"
+                                                    << "readConcern"
+                                                    << BSON("level"
+                                                            << "local"));
+    const BSONObj kLocalFindCmdTargeted = BSON("find"
+                                               << "coll"
+                                               << "filter" << BSON("_id" << 0) << "readConcern"
+                                               << BSON("level"
+                                                       << "local"));
+
+    void setUp() override {
+        ClusterFindTest::setUp();
+        ClusterFindResultCache::set(getServiceContext(),
+                                    std::make_unique<ClusterFindResultCache>(10, &_clockSource));
+    }
+
+    /**
+     * Runs 'cmd' outside of a transaction and returns the documents of its first batch. Each of
+     * the first 'numShardsTargeted' shards is expected to receive the command.
+     */
+    std::vector<BSONObj> runFind(const BSONObj& cmd, size_t numShardsTargeted) {
+        auto future = launchAsync([&] { return runCommand(cmd); });
+        for (size_t i = 0; i < numShardsTargeted; i++) {
+            expectReturnsSuccess(i);
+        }
+
+        const auto response = OpMsg::parse(future.default_timed_get().response).body;
+        ASSERT_OK(getStatusFromCommandResult(response));
+
+        std::vector<BSONObj> docs;
+        for (auto&& elem : response["cursor"]["firstBatch"].Obj()) {
+            docs.push_back(elem.Obj().getOwned());
+        }
+        return docs;
+    }
+
+    BSONObj getMetrics() {
+        BSONObjBuilder builder;
+        ClusterFindResultCache::get(getServiceContext())->report(&builder);
+        return builder.obj()["findResultCache"].Obj().getOwned();
+    }
+
+    ClockSourceMock _clockSource;
+};
+
+TEST_F(ClusterFindResultCacheTest, TargetedFindIsServedFromCache) {
+    ASSERT_EQ(1U, runFind(kLocalFindCmdTargeted, 1).size());
+
+    // The shard is not contacted again.
+    const auto docs = runFind(kLocalFindCmdTargeted, 0);
+    ASSERT_EQ(1U, docs.size());
+    ASSERT_BSONOBJ_EQ(BSON("_id" << 0), docs[0]);
+    ASSERT_EQ(1, getMetrics()["numHits"].numberLong());
+}
+
+TEST_F(ClusterFindResultCacheTest, ScatterGatherFindIsNotCached) {
+    ASSERT_EQ(2U, runFind(kLocalFindCmdScatterGather, numShards).size());
+    ASSERT_EQ(2U, runFind(kLocalFindCmdScatterGather, numShards).size());
+    ASSERT_EQ(0, getMetrics()["numEntries"].numberLong());
+}
+
+TEST_F(ClusterFindResultCacheTest, WriteInvalidatesCachedFind) {
+    ASSERT_EQ(1U, runFind(kLocalFindCmdTargeted, 1).size());
+
+    auto future = launchAsync([&] {
+        runCommand(BSON("insert"
+                        << "coll"
+                        << "documents" << BSON_ARRAY(BSON("_id" << 1)) << "writeConcern"
+                        << BSON("w" << 1)));
+    });
+    onCommandForPoolExecutor([&](const executor::RemoteCommandRequest& request) {
+        ASSERT_EQ("insert", request.cmdObj.firstElement().fieldNameStringData());
+        return BSON("ok" << 1 << "n" << 1);
+    });
+    future.default_timed_get();
+
+    // The find is sent to the shard again.
+    ASSERT_EQ(1U, runFind(kLocalFindCmdTargeted, 1).size());
+    ASSERT_EQ(0, getMetrics()["numHits"].numberLong());
+    ASSERT_EQ(1, getMetrics()["numInvalidations"].numberLong());
+}
+
 }  // namespace
 }  // namespace mongo
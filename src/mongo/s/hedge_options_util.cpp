@@ -45,6 +45,10 @@ const std::set<std::string> supportedCmds{"collStats",
                                           "listCollections",
                                           "listIndexes",
                                           "planCacheListFilters"};
+
+// With latency aware host selection, only hedge the reads which take longer than this percentile
+// of their target's recent latency.
+const double kHedgeDelayPercentile = 90;
 }  // namespace
 
 boost::optional<executor::RemoteCommandRequestOnAny::HedgeOptions> extractHedgeOptions(
@@ -57,10 +61,25 @@ boost::optional<executor::RemoteCommandRequestOnAny::HedgeOptions> extractHedgeO
     auto cmdName(cmdObj.firstElement().fieldNameStringData().toString());
 
     if (supportedCmds.count(cmdName)) {
-        return executor::RemoteCommandRequestOnAny::HedgeOptions{1,
-                                                                 gMaxTimeMSForHedgedReads.load()};
+        executor::RemoteCommandRequestOnAny::HedgeOptions hedgeOptions{
+            1, gMaxTimeMSForHedgedReads.load()};
+        if (gEnableLatencyAwareReadHostSelection.load()) {
+            hedgeOptions.delayPercentile = kHedgeDelayPercentile;
+        }
+        return hedgeOptions;
     }
     return boost::none;
 }
 
+bool isLatencyAwareReadHostSelectionEnabled(const BSONObj& cmdObj,
+                                            const ReadPreferenceSetting& readPref) {
+    if (!gEnableLatencyAwareReadHostSelection.load() ||
+        readPref.pref == ReadPreference::PrimaryOnly) {
+        return false;
+    }
+
+    auto cmdName(cmdObj.firstElement().fieldNameStringData().toString());
+    return supportedCmds.count(cmdName);
+}
+
 }  // namespace mongo
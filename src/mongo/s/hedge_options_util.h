@@ -42,4 +42,11 @@ namespace mongo {
 boost::optional<executor::RemoteCommandRequestOnAny::HedgeOptions> extractHedgeOptions(
     const BSONObj& cmdObj, const ReadPreferenceSetting& readPref);
 
+/**
+ * Returns whether the host to run the given read on should be selected based on the latency
+ * recently observed from each candidate host.
+ */
+bool isLatencyAwareReadHostSelectionEnabled(const BSONObj& cmdObj,
+                                            const ReadPreferenceSetting& readPref);
+
 }  // namespace mongo
@@ -93,10 +93,13 @@ protected:
     static inline const std::string kReadHedgingModeFieldName = "readHedgingMode";
     static inline const std::string kMaxTimeMSForHedgedReadsFieldName = "maxTimeMSForHedgedReads";
     static inline const int kMaxTimeMSForHedgedReadsDefault = 10;
+    static inline const std::string kEnableLatencyAwareReadHostSelectionFieldName =
+        "enableLatencyAwareReadHostSelection";
 
     static inline const BSONObj kDefaultParameters =
         BSON(kReadHedgingModeFieldName << "on" << kMaxTimeMSForHedgedReadsFieldName
-                                       << kMaxTimeMSForHedgedReadsDefault);
+                                       << kMaxTimeMSForHedgedReadsDefault
+                                       << kEnableLatencyAwareReadHostSelectionFieldName << false);
 
 private:
     ServiceContext::UniqueServiceContext _serviceCtx = ServiceContext::make();
@@ -191,5 +194,33 @@ TEST_F(HedgeOptionsUtilTestFixture, MaxTimeMSForHedgedReads) {
     checkHedgeOptions(parameters, cmdObj, rspObj, true, 100);
 }
 
+TEST_F(HedgeOptionsUtilTestFixture, LatencyAwareReadHostSelectionDelaysHedges) {
+    const auto cmdObj = BSON("find" << kCollName);
+    const auto readPref = uassertStatusOK(ReadPreferenceSetting::fromInnerBSON(BSON("mode"
+                                                                                   << "nearest")));
+
+    ASSERT_FALSE(isLatencyAwareReadHostSelectionEnabled(cmdObj, readPref));
+    ASSERT_FALSE(extractHedgeOptions(cmdObj, readPref)->delayPercentile);
+
+    setParameters(BSON(kEnableLatencyAwareReadHostSelectionFieldName << true));
+
+    ASSERT_TRUE(isLatencyAwareReadHostSelectionEnabled(cmdObj, readPref));
+    ASSERT_EQ(90, *extractHedgeOptions(cmdObj, readPref)->delayPercentile);
+}
+
+TEST_F(HedgeOptionsUtilTestFixture, LatencyAwareReadHostSelectionSkipsPrimaryAndWrites) {
+    setParameters(BSON(kEnableLatencyAwareReadHostSelectionFieldName << true));
+
+    const auto nearest = uassertStatusOK(ReadPreferenceSetting::fromInnerBSON(BSON("mode"
+                                                                                  << "nearest")));
+    const auto primary = uassertStatusOK(ReadPreferenceSetting::fromInnerBSON(BSON("mode"
+                                                                                  << "primary")));
+
+    ASSERT_FALSE(isLatencyAwareReadHostSelectionEnabled(BSON("find" << kCollName), primary));
+    ASSERT_FALSE(isLatencyAwareReadHostSelectionEnabled(
+        BSON("aggregate" << kCollName << "pipeline" << BSONObj() << "cursor" << BSONObj()),
+        nearest));
+}
+
 }  // namespace
 }  // namespace mongo
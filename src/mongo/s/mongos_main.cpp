@@ -77,6 +77,7 @@
 #include "mongo/rpc/metadata/egress_metadata_hook_list.h"
 #include "mongo/s/balancer_configuration.h"
 #include "mongo/s/catalog_cache.h"
+#include "mongo/s/catalog_cache_snapshot.h"
 #include "mongo/s/client/shard_factory.h"
 #include "mongo/s/client/shard_registry.h"
 #include "mongo/s/client/shard_remote.h"
@@ -355,6 +356,19 @@ void cleanupTask(const ShutdownTaskArgs& shutdownArgs) {
 
         if (Grid::get(serviceContext)->isShardingInitialized()) {
             CatalogCacheLoader::get(serviceContext).shutDown();
+
+            // Persist the cached routing tables so that the next startup can refresh them
+            // incrementally instead of loading every chunk from the config server again
+            if (!gRoutingTableCacheSnapshotPath.empty()) {
+                auto status = writeCatalogCacheSnapshot(Grid::get(serviceContext)->catalogCache(),
+                                                        gRoutingTableCacheSnapshotPath);
+                if (!status.isOK()) {
+                    LOGV2_WARNING(5094101,
+                                  "Error writing routing table cache snapshot",
+                                  "path"_attr = gRoutingTableCacheSnapshotPath,
+                                  "error"_attr = status);
+                }
+            }
         }
 
 #if __has_feature(address_sanitizer)
@@ -737,6 +751,22 @@ ExitCode runMongosServer(ServiceContext* serviceContext) {
             return EXIT_SHARDING_ERROR;
         }
 
+        if (!gRoutingTableCacheSnapshotPath.empty()) {
+            auto swNumCollections = loadCatalogCacheSnapshot(
+                opCtx, Grid::get(serviceContext)->catalogCache(), gRoutingTableCacheSnapshotPath);
+            if (swNumCollections.isOK()) {
+                LOGV2(5094102,
+                      "Seeded routing table cache from snapshot",
+                      "path"_attr = gRoutingTableCacheSnapshotPath,
+                      "numCollections"_attr = swNumCollections.getValue());
+            } else {
+                LOGV2_WARNING(5094103,
+                              "Ignoring routing table cache snapshot which could not be loaded",
+                              "path"_attr = gRoutingTableCacheSnapshotPath,
+                              "error"_attr = swNumCollections.getStatus());
+            }
+        }
+
         Grid::get(serviceContext)
             ->getBalancerConfiguration()
             ->refreshAndCheck(opCtx)
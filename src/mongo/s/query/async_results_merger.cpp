@@ -93,6 +93,18 @@ int compareSortKeys(BSONObj leftSortKey, BSONObj rightSortKey, BSONObj sortKeyPa
     return leftSortKey.woCompare(rightSortKey, sortKeyPattern, rules);
 }
 
+/**
+ * Returns the Ordering with which the sort keys of a sorted merge are encoded as KeyStrings, or
+ * boost::none if there is no sort or if the sort pattern has more fields than a KeyString Ordering
+ * can describe, in which case the sort keys are compared as BSON.
+ */
+boost::optional<Ordering> makeSortKeyOrdering(const boost::optional<BSONObj>& sort) {
+    if (!sort || static_cast<size_t>(sort->nFields()) > Ordering::kMaxCompoundIndexKeys) {
+        return boost::none;
+    }
+    return Ordering::make(*sort);
+}
+
 }  // namespace
 
 AsyncResultsMerger::AsyncResultsMerger(OperationContext* opCtx,
@@ -105,8 +117,11 @@ AsyncResultsMerger::AsyncResultsMerger(OperationContext* opCtx,
       // since that is not supported we treat boost::none (unspecified) to mean 'kNormal'.
       _tailableMode(params.getTailableMode().value_or(TailableModeEnum::kNormal)),
       _params(std::move(params)),
-      _mergeQueue(MergingComparator(
-          _remotes, _params.getSort().value_or(BSONObj()), _params.getCompareWholeSortKey())),
+      _sortKeyOrdering(makeSortKeyOrdering(_params.getSort())),
+      _mergingComparator(_remotes,
+                         _params.getSort().value_or(BSONObj()),
+                         _params.getCompareWholeSortKey(),
+                         _sortKeyOrdering.has_value()),
       _promisedMinSortKeys(PromisedMinSortKeyComparator(_params.getSort().value_or(BSONObj()))) {
     if (params.getTxnNumber()) {
         invariant(params.getSessionId());
@@ -307,12 +322,12 @@ bool AsyncResultsMerger::_readySorted(WithLock lk) {
 }
 
 bool AsyncResultsMerger::_readySortedTailable(WithLock lk) {
-    if (_mergeQueue.empty()) {
+    auto smallestRemote = _getNextRemoteInSortOrder(lk);
+    if (!smallestRemote) {
         return false;
     }
 
-    auto smallestRemote = _mergeQueue.top();
-    auto smallestResult = _remotes[smallestRemote].docBuffer.front();
+    const auto& smallestResult = _remotes[*smallestRemote].docBuffer.front();
     auto keyWeWantToReturn =
         extractSortKey(*smallestResult.getResult(), _params.getCompareWholeSortKey());
     // We should always have a minPromisedSortKey from every shard in the sorted tailable case.
@@ -355,29 +370,28 @@ StatusWith<ClusterQueryResult> AsyncResultsMerger::nextReady() {
     return _params.getSort() ? _nextReadySorted(lk) : _nextReadyUnsorted(lk);
 }
 
-ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
+ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock lk) {
     // Tailable non-awaitData cursors cannot have a sort.
     invariant(_tailableMode != TailableModeEnum::kTailable);
 
-    if (_mergeQueue.empty()) {
+    auto nextRemote = _getNextRemoteInSortOrder(lk);
+    if (!nextRemote) {
         return {};
     }
 
-    size_t smallestRemote = _mergeQueue.top();
-    _mergeQueue.pop();
-
+    const size_t smallestRemote = *nextRemote;
     invariant(!_remotes[smallestRemote].docBuffer.empty());
     invariant(_remotes[smallestRemote].status.isOK());
 
-    ClusterQueryResult front = _remotes[smallestRemote].docBuffer.front();
+    ClusterQueryResult front = std::move(_remotes[smallestRemote].docBuffer.front());
     _remotes[smallestRemote].docBuffer.pop();
-
-    // Re-populate the merging queue with the next result from 'smallestRemote', if it has a
-    // next result.
-    if (!_remotes[smallestRemote].docBuffer.empty()) {
-        _mergeQueue.push(smallestRemote);
+    if (_sortKeyOrdering) {
+        _remotes[smallestRemote].sortKeyBuffer.pop();
     }
 
+    // Let the next result from 'smallestRemote', if it has one, compete for the next spot.
+    _replayMergeTree(lk, smallestRemote);
+
     // For sorted tailable awaitData cursors, update the high water mark to the document's sort key.
     if (_tailableMode == TailableModeEnum::kTailableAndAwaitData) {
         if (_remotes[smallestRemote].eligibleForHighWaterMark) {
@@ -389,6 +403,54 @@ ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
     return front;
 }
 
+boost::optional<size_t> AsyncResultsMerger::_getNextRemoteInSortOrder(WithLock lk) {
+    if (_remotes.empty()) {
+        return boost::none;
+    }
+
+    // The tree also has to be rebuilt if remotes were added since it was last built.
+    if (_mergeTreeNeedsRebuild || _mergeTree.size() != _remotes.size()) {
+        _mergeTree.resize(_remotes.size());
+        _mergeTree[0] = _buildMergeTree(lk, 1);
+        _mergeTreeNeedsRebuild = false;
+    }
+
+    // Remotes without buffered results lose every match, so if the winner has none, none do.
+    const size_t winner = _mergeTree[0];
+    if (!_remotes[winner].hasNext()) {
+        return boost::none;
+    }
+    return winner;
+}
+
+size_t AsyncResultsMerger::_buildMergeTree(WithLock lk, size_t node) {
+    const size_t numRemotes = _remotes.size();
+    if (node >= numRemotes) {
+        return node - numRemotes;
+    }
+
+    const size_t leftWinner = _buildMergeTree(lk, 2 * node);
+    const size_t rightWinner = _buildMergeTree(lk, 2 * node + 1);
+    if (_mergingComparator(rightWinner, leftWinner)) {
+        _mergeTree[node] = leftWinner;
+        return rightWinner;
+    }
+    _mergeTree[node] = rightWinner;
+    return leftWinner;
+}
+
+void AsyncResultsMerger::_replayMergeTree(WithLock, size_t remoteIndex) {
+    invariant(_mergeTree.size() == _remotes.size());
+    dassert(_mergeTree[0] == remoteIndex);
+    size_t winner = remoteIndex;
+    for (size_t node = (_remotes.size() + remoteIndex) / 2; node > 0; node /= 2) {
+        if (_mergingComparator(_mergeTree[node], winner)) {
+            std::swap(_mergeTree[node], winner);
+        }
+    }
+    _mergeTree[0] = winner;
+}
+
 ClusterQueryResult AsyncResultsMerger::_nextReadyUnsorted(WithLock) {
     size_t remotesAttempted = 0;
     while (remotesAttempted < _remotes.size()) {
@@ -708,6 +770,9 @@ void AsyncResultsMerger::_cleanUpFailedBatch(WithLock lk, Status status, size_t
         remote.partialResultsReturned = (remote.status != ErrorCodes::ExchangePassthrough);
         std::queue<ClusterQueryResult> emptyBuffer;
         std::swap(remote.docBuffer, emptyBuffer);
+        std::queue<KeyString::Value> emptySortKeyBuffer;
+        std::swap(remote.sortKeyBuffer, emptySortKeyBuffer);
+        _mergeTreeNeedsRebuild = true;
         remote.status = Status::OK();
         remote.cursorId = 0;
     }
@@ -782,15 +847,23 @@ bool AsyncResultsMerger::_addBatchToBuffer(WithLock lk,
             }
         }
 
+        if (_sortKeyOrdering) {
+            KeyString::PooledBuilder sortKey(
+                _sortKeyPool,
+                KeyString::Version::kLatestVersion,
+                extractSortKey(obj, _params.getCompareWholeSortKey()),
+                *_sortKeyOrdering);
+            remote.sortKeyBuffer.push(sortKey.release());
+        }
+
         ClusterQueryResult result(obj);
         remote.docBuffer.push(result);
         ++remote.fetchedCount;
     }
 
-    // If we're doing a sorted merge, then we have to make sure to put this remote onto the merge
-    // queue.
+    // If we're doing a sorted merge, then this remote has to take part in the merge again.
     if (_params.getSort() && !response.getBatch().empty()) {
-        _mergeQueue.push(remoteIndex);
+        _mergeTreeNeedsRebuild = true;
     }
     return true;
 }
@@ -907,13 +980,23 @@ bool AsyncResultsMerger::RemoteCursorData::exhausted() const {
 // AsyncResultsMerger::MergingComparator
 //
 
-bool AsyncResultsMerger::MergingComparator::operator()(const size_t& lhs, const size_t& rhs) {
-    const ClusterQueryResult& leftDoc = _remotes[lhs].docBuffer.front();
-    const ClusterQueryResult& rightDoc = _remotes[rhs].docBuffer.front();
+bool AsyncResultsMerger::MergingComparator::operator()(size_t lhs, size_t rhs) const {
+    if (!_remotes[lhs].hasNext() || !_remotes[rhs].hasNext()) {
+        return _remotes[lhs].hasNext() || (!_remotes[rhs].hasNext() && lhs < rhs);
+    }
 
-    return compareSortKeys(extractSortKey(*leftDoc.getResult(), _compareWholeSortKey),
-                           extractSortKey(*rightDoc.getResult(), _compareWholeSortKey),
-                           _sort) > 0;
+    int sortKeyComp;
+    if (_compareEncodedSortKeys) {
+        sortKeyComp =
+            _remotes[lhs].sortKeyBuffer.front().compare(_remotes[rhs].sortKeyBuffer.front());
+    } else {
+        const ClusterQueryResult& leftDoc = _remotes[lhs].docBuffer.front();
+        const ClusterQueryResult& rightDoc = _remotes[rhs].docBuffer.front();
+        sortKeyComp = compareSortKeys(extractSortKey(*leftDoc.getResult(), _compareWholeSortKey),
+                                      extractSortKey(*rightDoc.getResult(), _compareWholeSortKey),
+                                      _sort);
+    }
+    return sortKeyComp < 0 || (sortKeyComp == 0 && lhs < rhs);
 }
 
 bool AsyncResultsMerger::PromisedMinSortKeyComparator::operator()(
@@ -35,13 +35,16 @@
 
 #include "mongo/base/status_with.h"
 #include "mongo/bson/bsonobj.h"
+#include "mongo/bson/ordering.h"
 #include "mongo/db/cursor_id.h"
+#include "mongo/db/storage/key_string.h"
 #include "mongo/executor/task_executor.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/s/query/async_results_merger_params_gen.h"
 #include "mongo/s/query/cluster_query_result.h"
 #include "mongo/util/concurrency/with_lock.h"
 #include "mongo/util/net/hostandport.h"
+#include "mongo/util/shared_buffer_fragment.h"
 #include "mongo/util/time_support.h"
 
 namespace mongo {
@@ -88,8 +91,8 @@ public:
      * the hosts on which they exist in _remotes.
      *
      * Additionally copies each remote's first batch of results, if one exists, into that remote's
-     * docBuffer. If a sort is specified in the ClusterClientCursorParams, places the remotes with
-     * buffered results onto _mergeQueue.
+     * docBuffer. If a sort is specified in the ClusterClientCursorParams, the remotes with buffered
+     * results take part in the sorted merge through _mergeTree.
      *
      * The TaskExecutor* must remain valid for the lifetime of the ARM.
      *
@@ -308,6 +311,10 @@ private:
         // The buffer of results that have been retrieved but not yet returned to the caller.
         std::queue<ClusterQueryResult> docBuffer;
 
+        // The $sortKey of each result in 'docBuffer', in the same order, encoded as a KeyString.
+        // Only populated for sorted merges whose sort pattern can be encoded.
+        std::queue<KeyString::Value> sortKeyBuffer;
+
         // Is valid if there is currently a pending request to this remote.
         executor::TaskExecutor::CallbackHandle cbHandle;
 
@@ -320,14 +327,23 @@ private:
         long long fetchedCount = 0;
     };
 
+    /**
+     * Orders remotes by the sort key of their next buffered result. Returns true if the next
+     * result of remote 'lhs' must be returned before the next result of remote 'rhs'. Remotes
+     * without buffered results are ordered after all others, and ties are broken by remote index.
+     */
     class MergingComparator {
     public:
         MergingComparator(const std::vector<RemoteCursorData>& remotes,
                           const BSONObj& sort,
-                          bool compareWholeSortKey)
-            : _remotes(remotes), _sort(sort), _compareWholeSortKey(compareWholeSortKey) {}
+                          bool compareWholeSortKey,
+                          bool compareEncodedSortKeys)
+            : _remotes(remotes),
+              _sort(sort),
+              _compareWholeSortKey(compareWholeSortKey),
+              _compareEncodedSortKeys(compareEncodedSortKeys) {}
 
-        bool operator()(const size_t& lhs, const size_t& rhs);
+        bool operator()(size_t lhs, size_t rhs) const;
 
     private:
         const std::vector<RemoteCursorData>& _remotes;
@@ -338,6 +354,10 @@ private:
         // We extract the sort key {$sortKey: <value>}. The sort key pattern '_sort' is verified to
         // be {$sortKey: 1}.
         const bool _compareWholeSortKey;
+
+        // When '_compareEncodedSortKeys' is true, the remotes are compared by the KeyStrings in
+        // their 'sortKeyBuffer' rather than by the $sortKey of the buffered documents.
+        const bool _compareEncodedSortKeys;
     };
 
     using MinSortKeyRemoteIdPair = std::pair<BSONObj, size_t>;
@@ -354,6 +374,9 @@ private:
 
     enum LifecycleState { kAlive, kKillStarted, kKillComplete };
 
+    // Block size of the pool from which the encoded sort keys are allocated.
+    static constexpr size_t kSortKeyPoolBlockSize = 16 * 1024;
+
     /**
      * Parses the find or getMore command response object to a CursorResponse.
      *
@@ -393,6 +416,30 @@ private:
     ClusterQueryResult _nextReadySorted(WithLock);
     ClusterQueryResult _nextReadyUnsorted(WithLock);
 
+    //
+    // Helpers for the sorted merge.
+    //
+
+    /**
+     * Returns the index of the remote whose next buffered result comes first in the sort order, or
+     * boost::none if no remote has a buffered result. Rebuilds '_mergeTree' first if any remote
+     * has received new results since the tree was last built.
+     */
+    boost::optional<size_t> _getNextRemoteInSortOrder(WithLock);
+
+    /**
+     * Plays all the matches of the subtree of '_mergeTree' rooted at 'node', storing the loser of
+     * each match in its node. Returns the index of the remote which won the subtree.
+     */
+    size_t _buildMergeTree(WithLock, size_t node);
+
+    /**
+     * Replays the matches on the path from the leaf of 'remoteIndex' to the root of '_mergeTree'.
+     * Must only be called for the remote which won the previous tournament, after its next result
+     * was consumed.
+     */
+    void _replayMergeTree(WithLock, size_t remoteIndex);
+
     using CbData = executor::TaskExecutor::RemoteCommandCallbackArgs;
     using CbResponse = executor::TaskExecutor::ResponseStatus;
 
@@ -486,9 +533,27 @@ private:
     // Data tracking the state of our communication with each of the remote nodes.
     std::vector<RemoteCursorData> _remotes;
 
-    // The top of this priority queue is the index into '_remotes' for the remote host that has the
-    // next document to return, according to the sort order. Used only if there is a sort.
-    std::priority_queue<size_t, std::vector<size_t>, MergingComparator> _mergeQueue;
+    // Ordering of the sort pattern, used to encode the $sortKey of every buffered result as a
+    // KeyString once, so that the merge only has to compare bytes. Unset if there is no sort or if
+    // the sort pattern has too many fields to be encoded.
+    boost::optional<Ordering> _sortKeyOrdering;
+
+    // Pool from which the KeyStrings in the remotes' 'sortKeyBuffer' are allocated.
+    SharedBufferFragmentBuilder _sortKeyPool{kSortKeyPoolBlockSize};
+
+    MergingComparator _mergingComparator;
+
+    // Loser tree over '_remotes', used only if there is a sort. The remotes are the leaves of the
+    // tree, and node i > 0 holds the index of the remote which lost the match between the winners
+    // of its children 2i and 2i+1 (the leaf of remote r is node _remotes.size() + r). Node 0 holds
+    // the index of the overall winner, the remote with the next document to return. Consuming the
+    // winner's next result only requires replaying the matches on the path from its leaf to the
+    // root, which costs one comparison per level rather than the two of a binary heap.
+    std::vector<size_t> _mergeTree;
+
+    // Set when a remote receives new results or loses its buffered results. The merge tree is then
+    // rebuilt before it is next used, as only the winner's matches can be replayed.
+    bool _mergeTreeNeedsRebuild = false;
 
     // The index into '_remotes' for the remote from which we are currently retrieving results.
     // Used only if there is *not* a sort.
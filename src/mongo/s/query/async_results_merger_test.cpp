@@ -441,6 +441,46 @@ TEST_F(AsyncResultsMergerTest, CompoundSortKey) {
     ASSERT_TRUE(unittest::assertGet(arm->nextReady()).isEOF());
 }
 
+TEST_F(AsyncResultsMergerTest, SortedMergeOfManyRemotesComparesSortKeysByValue) {
+    BSONObj findCmd = fromjson("{find: 'testcoll', sort: {a: 1, b: -1}}");
+    const std::vector<std::vector<BSONObj>> batches = {
+        {fromjson("{$sortKey: [1, 'z']}"), fromjson("{$sortKey: [7.5, 'a']}")},
+        {},
+        {fromjson("{$sortKey: [1.0, 'a']}"), fromjson("{$sortKey: ['str', 'a']}")},
+        {fromjson("{$sortKey: [{$numberLong: '2'}, 'b']}")},
+        {fromjson("{$sortKey: [0.5, 'q']}"), fromjson("{$sortKey: [2, 'a']}")},
+        {fromjson("{$sortKey: [null, 'a']}"), fromjson("{$sortKey: [{$numberDecimal: '7'}, 'a']}")},
+        {fromjson("{$sortKey: [1, 'm']}")}};
+
+    std::vector<RemoteCursor> cursors;
+    for (size_t i = 0; i < batches.size(); ++i) {
+        const auto shard = i % kTestShardIds.size();
+        cursors.push_back(makeRemoteCursor(
+            kTestShardIds[shard], kTestShardHosts[shard], CursorResponse(kTestNss, 0, batches[i])));
+    }
+    auto arm = makeARMFromExistingCursors(std::move(cursors), findCmd);
+
+    // All the remotes are exhausted, so the ARM merges the initial batches in sorted order, with
+    // numbers of different types comparing by their value.
+    const std::vector<BSONObj> expected = {fromjson("{$sortKey: [null, 'a']}"),
+                                           fromjson("{$sortKey: [0.5, 'q']}"),
+                                           fromjson("{$sortKey: [1, 'z']}"),
+                                           fromjson("{$sortKey: [1, 'm']}"),
+                                           fromjson("{$sortKey: [1.0, 'a']}"),
+                                           fromjson("{$sortKey: [{$numberLong: '2'}, 'b']}"),
+                                           fromjson("{$sortKey: [2, 'a']}"),
+                                           fromjson("{$sortKey: [{$numberDecimal: '7'}, 'a']}"),
+                                           fromjson("{$sortKey: [7.5, 'a']}"),
+                                           fromjson("{$sortKey: ['str', 'a']}")};
+    for (const auto& expectedResult : expected) {
+        ASSERT_TRUE(arm->ready());
+        ASSERT_BSONOBJ_EQ(expectedResult, *unittest::assertGet(arm->nextReady()).getResult());
+    }
+
+    ASSERT_TRUE(arm->ready());
+    ASSERT_TRUE(unittest::assertGet(arm->nextReady()).isEOF());
+}
+
 TEST_F(AsyncResultsMergerTest, SortedButNoSortKey) {
     BSONObj findCmd = fromjson("{find: 'testcoll', sort: {a: -1, b: 1}}");
     std::vector<RemoteCursor> cursors;
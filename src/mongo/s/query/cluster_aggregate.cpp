@@ -42,6 +42,7 @@
 #include "mongo/db/logical_clock.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/pipeline/document_source_change_stream.h"
+#include "mongo/db/pipeline/document_source_merge.h"
 #include "mongo/db/pipeline/document_source_out.h"
 #include "mongo/db/pipeline/expression_context.h"
 #include "mongo/db/pipeline/lite_parsed_pipeline.h"
@@ -68,6 +69,7 @@
 #include "mongo/s/query/cluster_client_cursor_impl.h"
 #include "mongo/s/query/cluster_client_cursor_params.h"
 #include "mongo/s/query/cluster_cursor_manager.h"
+#include "mongo/s/query/cluster_find_result_cache.h"
 #include "mongo/s/query/cluster_query_knobs_gen.h"
 #include "mongo/s/query/document_source_merge_cursors.h"
 #include "mongo/s/query/establish_cursors.h"
@@ -77,6 +79,7 @@
 #include "mongo/s/stale_exception.h"
 #include "mongo/s/transaction_router.h"
 #include "mongo/util/net/socket_utils.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo {
 
@@ -188,6 +191,23 @@ void updateHostsTargetedMetrics(OperationContext* opCtx,
     }
 }
 
+// Returns the namespaces written to by the final $out or $merge stage of the pipeline in 'request',
+// or an empty set if the pipeline does not write.
+stdx::unordered_set<NamespaceString> getOutputNamespaces(const NamespaceString& nss,
+                                                         const AggregationRequest& request) {
+    const auto& pipeline = request.getPipeline();
+    if (request.getExplain() || pipeline.empty()) {
+        return {};
+    }
+
+    const auto lastStageName = pipeline.back().firstElementFieldNameStringData();
+    if (lastStageName != DocumentSourceOut::kStageName &&
+        lastStageName != DocumentSourceMerge::kStageName) {
+        return {};
+    }
+    return LiteParsedPipeline(nss, {pipeline.back()}).getInvolvedNamespaces();
+}
+
 }  // namespace
 
 Status ClusterAggregate::runAggregate(OperationContext* opCtx,
@@ -225,6 +245,15 @@ Status ClusterAggregate::runAggregate(OperationContext* opCtx,
     auto hasChangeStream = liteParsedPipeline.hasChangeStream();
     auto involvedNamespaces = liteParsedPipeline.getInvolvedNamespaces();
 
+    // The writes of a $out or $merge stage are not routed through ClusterWriter when the stage
+    // runs on the shards, so the results cached for the output collection are invalidated here.
+    const auto outputNamespaces = getOutputNamespaces(namespaces.executionNss, request);
+    ON_BLOCK_EXIT([&] {
+        for (const auto& nss : outputNamespaces) {
+            ClusterFindResultCache::get(opCtx)->onWrite(nss);
+        }
+    });
+
     // If the routing table is valid, we obtain a reference to it. If the table is not valid, then
     // either the database does not exist, or there are no shards in the cluster. In the latter
     // case, we always return an empty cursor. In the former case, if the requested aggregation is a
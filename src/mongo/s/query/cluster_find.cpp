@@ -61,6 +61,7 @@
 #include "mongo/s/query/async_results_merger.h"
 #include "mongo/s/query/cluster_client_cursor_impl.h"
 #include "mongo/s/query/cluster_cursor_manager.h"
+#include "mongo/s/query/cluster_find_result_cache.h"
 #include "mongo/s/query/establish_cursors.h"
 #include "mongo/s/query/store_possible_cursor.h"
 #include "mongo/s/stale_exception.h"
@@ -234,6 +235,46 @@ void updateNumHostsTargetedMetrics(OperationContext* opCtx,
         NumHostsTargetedMetrics::QueryType::kFindCmd, targetType);
 }
 
+/**
+ * Returns the handle with which to look up and cache the results of 'query' in the mongos find
+ * result cache, or boost::none if the cache is disabled or the results of 'query' may not be
+ * cached. Only finds by the full shard key which target a single shard, with read concern 'local'
+ * or 'available' against the primary and outside of transactions, are eligible.
+ */
+boost::optional<ClusterFindResultCache::CacheableFind> makeCacheableFind(
+    OperationContext* opCtx,
+    const CanonicalQuery& query,
+    const ReadPreferenceSetting& readPref,
+    const CachedCollectionRoutingInfo& routingInfo,
+    const std::set<ShardId>& shardIds) {
+    auto const resultCache = ClusterFindResultCache::get(opCtx);
+    if (!resultCache->isEnabled() || !routingInfo.cm() || shardIds.size() != 1 ||
+        readPref.pref != ReadPreference::PrimaryOnly || opCtx->getTxnNumber() ||
+        TransactionRouter::get(opCtx)) {
+        return boost::none;
+    }
+
+    const auto& readConcernArgs = ReadConcernArgs::get(opCtx);
+    const auto readConcernLevel = readConcernArgs.getLevel();
+    if ((readConcernLevel != repl::ReadConcernLevel::kLocalReadConcern &&
+         readConcernLevel != repl::ReadConcernLevel::kAvailableReadConcern) ||
+        readConcernArgs.getArgsOpTime() || readConcernArgs.getArgsAfterClusterTime() ||
+        readConcernArgs.getArgsAtClusterTime()) {
+        return boost::none;
+    }
+
+    const auto& qr = query.getQueryRequest();
+    if (qr.isTailable() || qr.isAllowPartialResults() ||
+        routingInfo.cm()->getShardKeyPattern().extractShardKeyFromQuery(query).isEmpty()) {
+        return boost::none;
+    }
+
+    return resultCache->makeCacheableFind(query.nss(),
+                                          qr.asFindCommand(),
+                                          readConcernLevel,
+                                          routingInfo.cm()->getVersion(*shardIds.begin()));
+}
+
 CursorId runQueryWithoutRetrying(OperationContext* opCtx,
                                  const CanonicalQuery& query,
                                  const ReadPreferenceSetting& readPref,
@@ -246,6 +287,16 @@ CursorId runQueryWithoutRetrying(OperationContext* opCtx,
                                               query.getQueryRequest().getFilter(),
                                               query.getQueryRequest().getCollation());
 
+    // Hot lookups by shard key may be served from the mongos find result cache without contacting
+    // the shard. The handle must be obtained before the find is sent, so that the results of a
+    // find which raced with a write through this mongos are not cached.
+    auto cacheableFind = makeCacheableFind(opCtx, query, readPref, routingInfo, shardIds);
+    if (cacheableFind && ClusterFindResultCache::get(opCtx)->lookup(*cacheableFind, results)) {
+        CurOp::get(opCtx)->debug().nreturned = results->size();
+        CurOp::get(opCtx)->debug().cursorExhausted = true;
+        return CursorId(0);
+    }
+
     // Construct the query and parameters. Defer setting skip and limit here until
     // we determine if the query is targeting multi-shards or a single shard below.
     ClusterClientCursorParams params(query.nss(), readPref, ReadConcernArgs::get(opCtx));
@@ -396,6 +447,10 @@ CursorId runQueryWithoutRetrying(OperationContext* opCtx,
     if (cursorState == ClusterCursorManager::CursorState::Exhausted) {
         CurOp::get(opCtx)->debug().cursorExhausted = true;
 
+        if (cacheableFind) {
+            ClusterFindResultCache::get(opCtx)->insert(*cacheableFind, *results);
+        }
+
         if (shardIds.size() > 0) {
             updateNumHostsTargetedMetrics(opCtx, routingInfo, shardIds.size());
         }
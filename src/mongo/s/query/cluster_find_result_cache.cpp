@@ -0,0 +1,244 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/s/query/cluster_find_result_cache.h"
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/service_context.h"
+#include "mongo/s/query/cluster_query_knobs_gen.h"
+#include "mongo/util/clock_source.h"
+
+namespace mongo {
+namespace {
+
+const auto getClusterFindResultCache =
+    ServiceContext::declareDecoration<std::unique_ptr<ClusterFindResultCache>>();
+
+ServiceContext::ConstructorActionRegisterer clusterFindResultCacheRegisterer{
+    "ClusterFindResultCache", [](ServiceContext* service) {
+        getClusterFindResultCache(service) = std::make_unique<ClusterFindResultCache>(
+            gMongosFindResultCacheSize, service->getFastClockSource());
+    }};
+
+}  // namespace
+
+ClusterFindResultCache::ClusterFindResultCache(size_t maxEntries, ClockSource* clockSource)
+    : _maxEntries(maxEntries), _clockSource(clockSource), _entries(maxEntries) {}
+
+ClusterFindResultCache* ClusterFindResultCache::get(ServiceContext* serviceContext) {
+    return getClusterFindResultCache(serviceContext).get();
+}
+
+ClusterFindResultCache* ClusterFindResultCache::get(OperationContext* opCtx) {
+    return get(opCtx->getServiceContext());
+}
+
+void ClusterFindResultCache::set(ServiceContext* serviceContext,
+                                 std::unique_ptr<ClusterFindResultCache> resultCache) {
+    getClusterFindResultCache(serviceContext) = std::move(resultCache);
+}
+
+ClusterFindResultCache::CacheableFind ClusterFindResultCache::makeCacheableFind(
+    const NamespaceString& nss,
+    const BSONObj& findCmd,
+    repl::ReadConcernLevel readConcernLevel,
+    const ChunkVersion& shardVersion) {
+    const auto readConcernLevelName = repl::readConcernLevels::toString(readConcernLevel);
+
+    std::string key;
+    key.reserve(nss.size() + 1 + readConcernLevelName.size() + 1 + findCmd.objsize());
+    key.append(nss.ns());
+    key.push_back('\0');
+    key.append(readConcernLevelName.rawData(), readConcernLevelName.size());
+    key.push_back('\0');
+    key.append(findCmd.objdata(), findCmd.objsize());
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    return {nss, std::move(key), shardVersion, _getWriteGeneration(lk, nss)};
+}
+
+bool ClusterFindResultCache::lookup(const CacheableFind& find, std::vector<BSONObj>* results) {
+    const auto maxStaleness = Milliseconds(gMongosFindResultCacheMaxStalenessMillis.load());
+    const auto now = _clockSource->now();
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    auto it = _entries.find(find.key);
+    if (it == _entries.end() || _hasOpenTransactionWrites(lk, find.nss)) {
+        ++_numMisses;
+        return false;
+    }
+
+    const auto& entry = it->second;
+    if (entry.writeGeneration != _getWriteGeneration(lk, find.nss) ||
+        entry.shardVersion != find.shardVersion || now - entry.cachedAt > maxStaleness) {
+        _entries.erase(it);
+        ++_numInvalidations;
+        ++_numMisses;
+        return false;
+    }
+
+    results->insert(results->end(), entry.results.begin(), entry.results.end());
+    ++_numHits;
+    return true;
+}
+
+void ClusterFindResultCache::insert(const CacheableFind& find,
+                                    const std::vector<BSONObj>& results) {
+    int totalBytes = 0;
+    for (const auto& result : results) {
+        totalBytes += result.objsize();
+        if (totalBytes > kMaxCachedResultBytes) {
+            return;
+        }
+    }
+
+    Entry entry{find.nss, find.shardVersion, find.writeGeneration, _clockSource->now(), {}};
+    entry.results.reserve(results.size());
+    for (const auto& result : results) {
+        entry.results.push_back(result.getOwned());
+    }
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    // A write may have been routed through this mongos while the find was in progress, in which
+    // case the results may predate it.
+    if (find.writeGeneration != _getWriteGeneration(lk, find.nss) ||
+        _hasOpenTransactionWrites(lk, find.nss)) {
+        return;
+    }
+
+    if (_entries.add(find.key, std::move(entry))) {
+        ++_numEvictions;
+    }
+}
+
+void ClusterFindResultCache::onWrite(const NamespaceString& nss) {
+    if (!isEnabled()) {
+        return;
+    }
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    ++_writeGenerations[nss];
+}
+
+void ClusterFindResultCache::onTransactionWrite(OperationContext* opCtx,
+                                                const NamespaceString& nss) {
+    if (!isEnabled() || !opCtx->inMultiDocumentTransaction()) {
+        return;
+    }
+
+    const auto& lsid = *opCtx->getLogicalSessionId();
+    const auto txnNumber = *opCtx->getTxnNumber();
+    const auto now = _clockSource->now();
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    _expireTransactions(lk);
+
+    auto it = _transactionWrites.find(lsid);
+    if (it != _transactionWrites.end() && it->second.txnNumber != txnNumber) {
+        // The session moved on to a newer transaction, so the previous one has ended.
+        _endTransaction(lk, it);
+        it = _transactionWrites.end();
+    }
+    if (it == _transactionWrites.end()) {
+        it = _transactionWrites.emplace(lsid, TransactionWrites{txnNumber, now, {}}).first;
+    }
+
+    if (it->second.namespaces.insert(nss).second) {
+        ++_numOpenTransactionWrites[nss];
+    }
+    ++_writeGenerations[nss];
+}
+
+void ClusterFindResultCache::onTransactionEnd(OperationContext* opCtx) {
+    if (!isEnabled() || !opCtx->getLogicalSessionId() || !opCtx->getTxnNumber()) {
+        return;
+    }
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    auto it = _transactionWrites.find(*opCtx->getLogicalSessionId());
+    if (it != _transactionWrites.end() && it->second.txnNumber == *opCtx->getTxnNumber()) {
+        _endTransaction(lk, it);
+    }
+}
+
+void ClusterFindResultCache::report(BSONObjBuilder* builder) const {
+    BSONObjBuilder cacheBuilder(builder->subobjStart("findResultCache"));
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    cacheBuilder.appendNumber("numEntries", static_cast<long long>(_entries.size()));
+    cacheBuilder.appendNumber("numHits", _numHits);
+    cacheBuilder.appendNumber("numMisses", _numMisses);
+    cacheBuilder.appendNumber("numInvalidations", _numInvalidations);
+    cacheBuilder.appendNumber("numEvictions", _numEvictions);
+}
+
+uint64_t ClusterFindResultCache::_getWriteGeneration(WithLock, const NamespaceString& nss) const {
+    auto it = _writeGenerations.find(nss);
+    return it == _writeGenerations.end() ? 0 : it->second;
+}
+
+bool ClusterFindResultCache::_hasOpenTransactionWrites(WithLock lk, const NamespaceString& nss) {
+    if (_numOpenTransactionWrites.find(nss) == _numOpenTransactionWrites.end()) {
+        return false;
+    }
+
+    _expireTransactions(lk);
+    return _numOpenTransactionWrites.find(nss) != _numOpenTransactionWrites.end();
+}
+
+void ClusterFindResultCache::_expireTransactions(WithLock lk) {
+    // Transactions which are abandoned, or which expire, are implicitly aborted or get reaped on
+    // the shards, are never ended through this mongos.
+    const auto expireBefore =
+        _clockSource->now() - Seconds(gMongosFindResultCacheTransactionLifetimeSecs.load());
+    for (auto it = _transactionWrites.begin(); it != _transactionWrites.end();) {
+        auto next = std::next(it);
+        if (it->second.firstWriteAt < expireBefore) {
+            _endTransaction(lk, it);
+        }
+        it = next;
+    }
+}
+
+void ClusterFindResultCache::_endTransaction(WithLock, TransactionWritesMap::iterator it) {
+    for (const auto& nss : it->second.namespaces) {
+        ++_writeGenerations[nss];
+
+        auto numOpenIt = _numOpenTransactionWrites.find(nss);
+        if (--numOpenIt->second == 0) {
+            _numOpenTransactionWrites.erase(numOpenIt);
+        }
+    }
+    _transactionWrites.erase(it);
+}
+
+}  // namespace mongo
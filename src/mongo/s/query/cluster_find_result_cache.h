@@ -0,0 +1,217 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <boost/optional.hpp>
+#include <string>
+#include <vector>
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/db/logical_session_id.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/repl/read_concern_level.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/s/chunk_version.h"
+#include "mongo/stdx/unordered_map.h"
+#include "mongo/stdx/unordered_set.h"
+#include "mongo/util/concurrency/with_lock.h"
+#include "mongo/util/lru_cache.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+
+class BSONObjBuilder;
+class ClockSource;
+class OperationContext;
+class ServiceContext;
+
+/**
+ * Bounded LRU cache of the results of targeted find commands on mongos, for read-heavy workloads
+ * which repeatedly look up the same documents by shard key.
+ *
+ * A cached result is only returned if none of the following happened since it was cached:
+ *  - a write to its collection was routed through this mongos (see onWrite()), or a transaction
+ *    which wrote to its collection through this mongos ended (see onTransactionEnd()),
+ *  - the version of the targeted shard changed in the routing table,
+ *  - more than 'mongosFindResultCacheMaxStalenessMillis' elapsed.
+ * The last condition bounds how stale the results can be with respect to writes routed through
+ * other routers, which this cache has no way to observe. Finds on a collection bypass the cache
+ * while a transaction which wrote to it through this mongos is open, or until
+ * 'mongosFindResultCacheTransactionLifetimeSecs' elapsed since its first such write.
+ *
+ * It is the caller's responsibility to only use the cache for finds whose semantics allow such
+ * results, see ClusterFind::runQuery.
+ */
+class ClusterFindResultCache {
+    ClusterFindResultCache(const ClusterFindResultCache&) = delete;
+    ClusterFindResultCache& operator=(const ClusterFindResultCache&) = delete;
+
+public:
+    // Results larger than this are not cached, so that a few large results cannot take up most of
+    // the memory used by the cache.
+    static constexpr int kMaxCachedResultBytes = 16 * 1024;
+
+    /**
+     * Identifies a find command eligible for caching, along with the state against which its
+     * results must be validated. Obtained through makeCacheableFind() before the find is sent to
+     * the shard.
+     */
+    struct CacheableFind {
+        NamespaceString nss;
+        std::string key;
+        ChunkVersion shardVersion;
+        uint64_t writeGeneration;
+    };
+
+    /**
+     * A 'maxEntries' of zero disables the cache.
+     */
+    ClusterFindResultCache(size_t maxEntries, ClockSource* clockSource);
+
+    static ClusterFindResultCache* get(ServiceContext* serviceContext);
+    static ClusterFindResultCache* get(OperationContext* opCtx);
+
+    static void set(ServiceContext* serviceContext,
+                    std::unique_ptr<ClusterFindResultCache> resultCache);
+
+    bool isEnabled() const {
+        return _maxEntries > 0;
+    }
+
+    /**
+     * Returns the handle with which to look up and cache the results of the find command
+     * 'findCmd' on 'nss' with the effective read concern level 'readConcernLevel', targeted to a
+     * shard with version 'shardVersion'. Finds with different read concern levels never share
+     * results.
+     */
+    CacheableFind makeCacheableFind(const NamespaceString& nss,
+                                    const BSONObj& findCmd,
+                                    repl::ReadConcernLevel readConcernLevel,
+                                    const ChunkVersion& shardVersion);
+
+    /**
+     * If valid cached results exist for 'find', appends them to 'results' and returns true.
+     * Otherwise drops any invalid cached results and returns false.
+     */
+    bool lookup(const CacheableFind& find, std::vector<BSONObj>* results);
+
+    /**
+     * Caches 'results' for 'find', unless a write to the collection was routed through this mongos
+     * since 'find' was obtained, or the results are too large.
+     */
+    void insert(const CacheableFind& find, const std::vector<BSONObj>& results);
+
+    /**
+     * Invalidates all the cached results for 'nss', including those of finds which are still in
+     * progress. Must be called once a write to 'nss' routed through this mongos has completed,
+     * whether or not it succeeded, so that no result read before the write can be returned after
+     * the write was acknowledged.
+     */
+    void onWrite(const NamespaceString& nss);
+
+    /**
+     * Must be called before a write to 'nss' is sent on behalf of 'opCtx'. Does nothing unless
+     * 'opCtx' runs in a multi-document transaction, in which case finds on 'nss' bypass the cache
+     * until the transaction ends, and the cached results for 'nss' are invalidated once it does.
+     *
+     * A transaction ends when onTransactionEnd() is called for it, when its session writes in a
+     * newer transaction through this mongos, or once 'mongosFindResultCacheTransactionLifetimeSecs'
+     * elapsed since its first write through this mongos, whichever comes first.
+     */
+    void onTransactionWrite(OperationContext* opCtx, const NamespaceString& nss);
+
+    /**
+     * Invalidates the cached results for every namespace written to by the transaction of 'opCtx'
+     * through this mongos. Must be called once the transaction was committed or aborted, whether
+     * or not the commit or abort succeeded.
+     */
+    void onTransactionEnd(OperationContext* opCtx);
+
+    /**
+     * Appends the cache metrics to 'builder'.
+     */
+    void report(BSONObjBuilder* builder) const;
+
+private:
+    struct Entry {
+        NamespaceString nss;
+        ChunkVersion shardVersion;
+        uint64_t writeGeneration;
+        Date_t cachedAt;
+        std::vector<BSONObj> results;
+    };
+
+    // The namespaces written to through this mongos by the open transaction of a session.
+    struct TransactionWrites {
+        TxnNumber txnNumber;
+        Date_t firstWriteAt;
+        stdx::unordered_set<NamespaceString> namespaces;
+    };
+
+    using TransactionWritesMap =
+        stdx::unordered_map<LogicalSessionId, TransactionWrites, LogicalSessionIdHash>;
+
+    uint64_t _getWriteGeneration(WithLock, const NamespaceString& nss) const;
+
+    /**
+     * Returns whether a transaction which wrote to 'nss' through this mongos is still open, after
+     * ending the transactions which outlived 'mongosFindResultCacheTransactionLifetimeSecs'.
+     */
+    bool _hasOpenTransactionWrites(WithLock, const NamespaceString& nss);
+
+    void _expireTransactions(WithLock);
+
+    void _endTransaction(WithLock, TransactionWritesMap::iterator it);
+
+    const size_t _maxEntries;
+
+    ClockSource* const _clockSource;
+
+    mutable Mutex _mutex = MONGO_MAKE_LATCH("ClusterFindResultCache::_mutex");
+
+    LRUCache<std::string, Entry> _entries;
+
+    // Number of writes routed through this mongos per collection. Cached results and finds in
+    // progress remember the value at the time their find was targeted, and are invalid once it
+    // changes. Only collections which have been written to since startup have an entry.
+    stdx::unordered_map<NamespaceString, uint64_t> _writeGenerations;
+
+    // Sessions whose open transaction wrote through this mongos, and the number of such
+    // transactions per namespace. Only namespaces with at least one such transaction have an entry.
+    TransactionWritesMap _transactionWrites;
+    stdx::unordered_map<NamespaceString, int> _numOpenTransactionWrites;
+
+    long long _numHits{0};
+    long long _numMisses{0};
+    long long _numInvalidations{0};
+    long long _numEvictions{0};
+};
+
+}  // namespace mongo
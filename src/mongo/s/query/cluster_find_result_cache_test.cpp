@@ -0,0 +1,276 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <string>
+#include <vector>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/query/query_test_service_context.h"
+#include "mongo/s/query/cluster_find_result_cache.h"
+#include "mongo/s/query/cluster_query_knobs_gen.h"
+#include "mongo/unittest/unittest.h"
+#include "mongo/util/clock_source_mock.h"
+
+namespace mongo {
+namespace {
+
+const NamespaceString kNss("test.collection");
+const NamespaceString kOtherNss("test.otherCollection");
+
+class ClusterFindResultCacheTest : public unittest::Test {
+protected:
+    ClusterFindResultCache::CacheableFind makeFind(
+        const NamespaceString& nss,
+        int shardKey,
+        ChunkVersion shardVersion = kShardVersion,
+        repl::ReadConcernLevel readConcernLevel = repl::ReadConcernLevel::kLocalReadConcern) {
+        return _cache.makeCacheableFind(nss,
+                                        BSON("find" << nss.coll() << "filter"
+                                                    << BSON("sk" << shardKey)),
+                                        readConcernLevel,
+                                        shardVersion);
+    }
+
+    std::vector<BSONObj> lookup(const ClusterFindResultCache::CacheableFind& find) {
+        std::vector<BSONObj> results;
+        if (!_cache.lookup(find, &results)) {
+            ASSERT(results.empty());
+        }
+        return results;
+    }
+
+    BSONObj getMetrics() {
+        BSONObjBuilder builder;
+        _cache.report(&builder);
+        return builder.obj()["findResultCache"].Obj().getOwned();
+    }
+
+    ServiceContext::UniqueOperationContext makeTransactionOperationContext(
+        const LogicalSessionId& lsid, TxnNumber txnNumber) {
+        auto opCtx = _serviceContext.makeOperationContext(lsid);
+        opCtx->setTxnNumber(txnNumber);
+        opCtx->setInMultiDocumentTransaction();
+        return opCtx;
+    }
+
+    void onTransactionWrite(const LogicalSessionId& lsid,
+                            TxnNumber txnNumber,
+                            const NamespaceString& nss) {
+        auto opCtx = makeTransactionOperationContext(lsid, txnNumber);
+        _cache.onTransactionWrite(opCtx.get(), nss);
+    }
+
+    void onTransactionEnd(const LogicalSessionId& lsid, TxnNumber txnNumber) {
+        auto opCtx = makeTransactionOperationContext(lsid, txnNumber);
+        _cache.onTransactionEnd(opCtx.get());
+    }
+
+    static const ChunkVersion kShardVersion;
+
+    QueryTestServiceContext _serviceContext;
+    ClockSourceMock _clockSource;
+    ClusterFindResultCache _cache{2, &_clockSource};
+};
+
+const ChunkVersion ClusterFindResultCacheTest::kShardVersion(2, 0, OID::gen());
+
+TEST_F(ClusterFindResultCacheTest, ReturnsCachedResults) {
+    const std::vector<BSONObj> results = {BSON("_id" << 1 << "sk" << 1)};
+
+    ASSERT(lookup(makeFind(kNss, 1)).empty());
+    _cache.insert(makeFind(kNss, 1), results);
+
+    const auto cachedResults = lookup(makeFind(kNss, 1));
+    ASSERT_EQ(1U, cachedResults.size());
+    ASSERT_BSONOBJ_EQ(results[0], cachedResults[0]);
+    ASSERT(lookup(makeFind(kNss, 2)).empty());
+
+    const auto metrics = getMetrics();
+    ASSERT_EQ(1, metrics["numEntries"].numberLong());
+    ASSERT_EQ(1, metrics["numHits"].numberLong());
+    ASSERT_EQ(2, metrics["numMisses"].numberLong());
+}
+
+TEST_F(ClusterFindResultCacheTest, WriteInvalidatesResultsOfItsCollectionOnly) {
+    _cache.insert(makeFind(kNss, 1), {BSON("_id" << 1 << "sk" << 1)});
+    _cache.insert(makeFind(kOtherNss, 1), {BSON("_id" << 1 << "sk" << 1)});
+
+    _cache.onWrite(kNss);
+
+    ASSERT(lookup(makeFind(kNss, 1)).empty());
+    ASSERT_EQ(1U, lookup(makeFind(kOtherNss, 1)).size());
+    ASSERT_EQ(1, getMetrics()["numInvalidations"].numberLong());
+}
+
+TEST_F(ClusterFindResultCacheTest, ResultsOfFindWhichRacedWithWriteAreNotCached) {
+    const auto find = makeFind(kNss, 1);
+    _cache.onWrite(kNss);
+    _cache.insert(find, {BSON("_id" << 1 << "sk" << 1)});
+
+    ASSERT(lookup(makeFind(kNss, 1)).empty());
+    ASSERT_EQ(0, getMetrics()["numEntries"].numberLong());
+}
+
+TEST_F(ClusterFindResultCacheTest, ShardVersionChangeInvalidatesResults) {
+    _cache.insert(makeFind(kNss, 1), {BSON("_id" << 1 << "sk" << 1)});
+
+    const ChunkVersion newShardVersion(3, 0, kShardVersion.epoch());
+    ASSERT(lookup(makeFind(kNss, 1, newShardVersion)).empty());
+    ASSERT_EQ(1, getMetrics()["numInvalidations"].numberLong());
+}
+
+TEST_F(ClusterFindResultCacheTest, ReadConcernLevelsDoNotShareResults) {
+    _cache.insert(
+        makeFind(kNss, 1, kShardVersion, repl::ReadConcernLevel::kAvailableReadConcern),
+        {BSON("_id" << 1 << "sk" << 1)});
+
+    ASSERT(lookup(makeFind(kNss, 1, kShardVersion, repl::ReadConcernLevel::kLocalReadConcern))
+               .empty());
+    ASSERT_EQ(
+        1U,
+        lookup(makeFind(kNss, 1, kShardVersion, repl::ReadConcernLevel::kAvailableReadConcern))
+            .size());
+}
+
+TEST_F(ClusterFindResultCacheTest, StaleResultsAreInvalidated) {
+    _cache.insert(makeFind(kNss, 1), {BSON("_id" << 1 << "sk" << 1)});
+
+    _clockSource.advance(Milliseconds(gMongosFindResultCacheMaxStalenessMillis.load()));
+    ASSERT_EQ(1U, lookup(makeFind(kNss, 1)).size());
+
+    _clockSource.advance(Milliseconds(1));
+    ASSERT(lookup(makeFind(kNss, 1)).empty());
+}
+
+TEST_F(ClusterFindResultCacheTest, EvictsLeastRecentlyUsedResults) {
+    _cache.insert(makeFind(kNss, 1), {BSON("_id" << 1 << "sk" << 1)});
+    _cache.insert(makeFind(kNss, 2), {BSON("_id" << 2 << "sk" << 2)});
+    ASSERT_EQ(1U, lookup(makeFind(kNss, 1)).size());
+
+    _cache.insert(makeFind(kNss, 3), {BSON("_id" << 3 << "sk" << 3)});
+
+    ASSERT_EQ(1U, lookup(makeFind(kNss, 1)).size());
+    ASSERT(lookup(makeFind(kNss, 2)).empty());
+    ASSERT_EQ(1U, lookup(makeFind(kNss, 3)).size());
+    ASSERT_EQ(1, getMetrics()["numEvictions"].numberLong());
+}
+
+TEST_F(ClusterFindResultCacheTest, TransactionWriteBypassesCacheUntilTransactionEnds) {
+    const auto lsid = makeLogicalSessionIdForTest();
+    _cache.insert(makeFind(kNss, 1), {BSON("_id" << 1 << "sk" << 1)});
+
+    onTransactionWrite(lsid, 1, kNss);
+    _cache.onWrite(kNss);
+
+    // While the transaction is open, results are neither returned nor cached.
+    ASSERT(lookup(makeFind(kNss, 1)).empty());
+    const auto findDuringTransaction = makeFind(kNss, 1);
+    _cache.insert(findDuringTransaction, {BSON("_id" << 1 << "sk" << 1)});
+    ASSERT(lookup(makeFind(kNss, 1)).empty());
+
+    // Results read while the transaction was open may predate its commit.
+    onTransactionEnd(lsid, 1);
+    _cache.insert(findDuringTransaction, {BSON("_id" << 1 << "sk" << 1)});
+    ASSERT(lookup(makeFind(kNss, 1)).empty());
+
+    _cache.insert(makeFind(kNss, 1), {BSON("_id" << 1 << "sk" << 1)});
+    ASSERT_EQ(1U, lookup(makeFind(kNss, 1)).size());
+}
+
+TEST_F(ClusterFindResultCacheTest, TransactionEndInvalidatesResultsOfWrittenCollections) {
+    const auto lsid = makeLogicalSessionIdForTest();
+    onTransactionWrite(lsid, 1, kNss);
+
+    const auto find = makeFind(kNss, 1);
+    const auto otherFind = makeFind(kOtherNss, 1);
+    onTransactionEnd(lsid, 1);
+
+    _cache.insert(find, {BSON("_id" << 1 << "sk" << 1)});
+    _cache.insert(otherFind, {BSON("_id" << 1 << "sk" << 1)});
+    ASSERT(lookup(makeFind(kNss, 1)).empty());
+    ASSERT_EQ(1U, lookup(makeFind(kOtherNss, 1)).size());
+}
+
+TEST_F(ClusterFindResultCacheTest, NewerTransactionOnSessionEndsPreviousOne) {
+    const auto lsid = makeLogicalSessionIdForTest();
+    onTransactionWrite(lsid, 1, kNss);
+    onTransactionWrite(lsid, 2, kOtherNss);
+
+    _cache.insert(makeFind(kNss, 1), {BSON("_id" << 1 << "sk" << 1)});
+    _cache.insert(makeFind(kOtherNss, 1), {BSON("_id" << 1 << "sk" << 1)});
+    ASSERT_EQ(1U, lookup(makeFind(kNss, 1)).size());
+    ASSERT(lookup(makeFind(kOtherNss, 1)).empty());
+
+    // Ending the older transaction again does not end the newer one.
+    onTransactionEnd(lsid, 1);
+    _cache.insert(makeFind(kOtherNss, 1), {BSON("_id" << 1 << "sk" << 1)});
+    ASSERT(lookup(makeFind(kOtherNss, 1)).empty());
+}
+
+TEST_F(ClusterFindResultCacheTest, AbandonedTransactionStopsBypassingCacheOnceExpired) {
+    const auto lsid = makeLogicalSessionIdForTest();
+    onTransactionWrite(lsid, 1, kNss);
+
+    // The transaction is never committed or aborted through this mongos.
+    _clockSource.advance(Seconds(gMongosFindResultCacheTransactionLifetimeSecs.load()));
+    _cache.insert(makeFind(kNss, 1), {BSON("_id" << 1 << "sk" << 1)});
+    ASSERT(lookup(makeFind(kNss, 1)).empty());
+
+    // Once its lifetime has elapsed, it is considered ended.
+    _clockSource.advance(Milliseconds(1));
+    ASSERT(lookup(makeFind(kNss, 1)).empty());
+    _cache.insert(makeFind(kNss, 1), {BSON("_id" << 1 << "sk" << 1)});
+    ASSERT_EQ(1U, lookup(makeFind(kNss, 1)).size());
+
+    // Ending it afterwards has no effect.
+    onTransactionEnd(lsid, 1);
+    ASSERT_EQ(1U, lookup(makeFind(kNss, 1)).size());
+}
+
+TEST_F(ClusterFindResultCacheTest, WriteOutsideTransactionDoesNotBypassCache) {
+    auto opCtx = _serviceContext.makeOperationContext();
+    _cache.onTransactionWrite(opCtx.get(), kNss);
+
+    _cache.insert(makeFind(kNss, 1), {BSON("_id" << 1 << "sk" << 1)});
+    ASSERT_EQ(1U, lookup(makeFind(kNss, 1)).size());
+}
+
+TEST_F(ClusterFindResultCacheTest, LargeResultsAreNotCached) {
+    const std::string largeString(ClusterFindResultCache::kMaxCachedResultBytes, 'x');
+    _cache.insert(makeFind(kNss, 1), {BSON("_id" << 1 << "sk" << 1 << "payload" << largeString)});
+
+    ASSERT(lookup(makeFind(kNss, 1)).empty());
+    ASSERT_EQ(0, getMetrics()["numEntries"].numberLong());
+}
+
+}  // namespace
+}  // namespace mongo
@@ -37,6 +37,7 @@
 #include "mongo/s/client/num_hosts_targeted_metrics.h"
 #include "mongo/s/client/shard_registry.h"
 #include "mongo/s/grid.h"
+#include "mongo/s/query/cluster_find_result_cache.h"
 
 namespace mongo {
 namespace {
@@ -88,6 +89,7 @@ public:
 
         numHostsTargetedMetrics.appendSection(&result);
         catalogCache->report(&result);
+        ClusterFindResultCache::get(opCtx)->report(&result);
         return result.obj();
     }
 
@@ -67,6 +67,11 @@ struct WriteErrorDetailComp {
 const int kEstUpdateOverheadBytes = (BSONObjMaxInternalSize - BSONObjMaxUserSize) / 100;
 const int kEstDeleteOverheadBytes = (BSONObjMaxInternalSize - BSONObjMaxUserSize) / 100;
 
+// Maximum number of writes in a row which an unordered batch may skip because every shard they
+// target already has a full batch for this round, before targeting stops for the round. Bounds the
+// per-round targeting work for batches which are heavily skewed towards a few shards.
+const int kMaxConsecutiveWritesToFullShards = 1000;
+
 /**
  * Returns a new write concern that has the copy of every field from the original
  * document but with a w set to 1. This is intended for upgrading { w: 0 } write
@@ -300,6 +305,14 @@ Status BatchWriteOp::targetBatch(const NSTargeter& targeter,
     TargetedBatchMap batchMap;
     std::set<ShardId> targetedShards;
 
+    // Shards whose batch for this round has reached the size or count limit. For unordered
+    // batches, a full batch for one shard does not end targeting - writes for the other shards keep
+    // being packed into their batches, so that a skewed batch does not leave most shards idle for
+    // most of the rounds.
+    std::set<ShardId> fullShards;
+    int numConsecutiveWritesToFullShards = 0;
+    const int nShardsOwningChunks = targeter.getNShardsOwningChunks();
+
     const size_t numWriteOps = _clientRequest.sizeWriteOps();
 
     for (size_t i = 0; i < numWriteOps; ++i) {
@@ -394,8 +407,27 @@ Status BatchWriteOp::targetBatch(const NSTargeter& targeter,
         if (wouldMakeBatchesTooBig(
                 writes, std::max(writeSizeBytes, errorResponsePotentialSizeBytes), batchMap)) {
             invariant(!batchMap.empty());
+
+            // Unsharded collections only have one shard, so there is nothing else to fill
+            if (ordered || nShardsOwningChunks == 0) {
+                writeOp.cancelWrites(nullptr);
+                break;
+            }
+
+            for (const auto write : writes) {
+                if (batchMap.find(&write->endpoint) != batchMap.end()) {
+                    fullShards.insert(write->endpoint.shardName);
+                }
+            }
             writeOp.cancelWrites(nullptr);
-            break;
+
+            // Once every shard which owns chunks has a full batch, nothing else can be added
+            if (fullShards.size() >= static_cast<size_t>(nShardsOwningChunks) ||
+                ++numConsecutiveWritesToFullShards >= kMaxConsecutiveWritesToFullShards) {
+                break;
+            }
+
+            continue;
         }
 
         if (!ordered && !batchMap.empty() &&
@@ -422,6 +454,7 @@ Status BatchWriteOp::targetBatch(const NSTargeter& targeter,
 
         // Relinquish ownership of TargetedWrites, now the TargetedBatches own them
         writesOwned.mutableVector().clear();
+        numConsecutiveWritesToFullShards = 0;
 
         //
         // Break if we're ordered and we have more than one endpoint - later writes cannot be
@@ -1537,6 +1537,130 @@ TEST_F(BatchWriteOpLimitTests, OneBigOneSmall) {
     ASSERT(batchOp.isFinished());
 }
 
+// Unordered batch where one shard's batch fills up - the other shard's writes should still be
+// targeted in the same round
+TEST_F(BatchWriteOpLimitTests, UnorderedFullBatchDoesNotStopOtherShards) {
+    NamespaceString nss("foo.bar");
+    ShardEndpoint endpointA(ShardId("shardA"), ChunkVersion::IGNORED());
+    ShardEndpoint endpointB(ShardId("shardB"), ChunkVersion::IGNORED());
+
+    auto targeter = initTargeterSplitRange(nss, endpointA, endpointB);
+
+    // Create a BSONObj (slightly) bigger than the maximum size by including a max-size string
+    const std::string bigString(BSONObjMaxUserSize, 'x');
+
+    BatchedCommandRequest request([&] {
+        write_ops::Insert insertOp(nss);
+        insertOp.setWriteCommandBase([] {
+            write_ops::WriteCommandBase wcb;
+            wcb.setOrdered(false);
+            return wcb;
+        }());
+        insertOp.setDocuments({BSON("x" << -1 << "data" << bigString),
+                               BSON("x" << -2),
+                               BSON("x" << 1),
+                               BSON("x" << 2)});
+        return insertOp;
+    }());
+
+    BatchWriteOp batchOp(_opCtx, request);
+
+    OwnedPointerMap<ShardId, TargetedWriteBatch> targetedOwned;
+    std::map<ShardId, TargetedWriteBatch*>& targeted = targetedOwned.mutableMap();
+    ASSERT_OK(batchOp.targetBatch(targeter, false, &targeted));
+    ASSERT_EQUALS(targeted.size(), 2u);
+    ASSERT_EQUALS(targeted[endpointA.shardName]->getWrites().size(), 1u);
+    ASSERT_EQUALS(targeted[endpointB.shardName]->getWrites().size(), 2u);
+
+    BatchedCommandResponse response;
+    buildResponse(1, &response);
+    batchOp.noteBatchResponse(*targeted[endpointA.shardName], response, nullptr);
+
+    buildResponse(2, &response);
+    batchOp.noteBatchResponse(*targeted[endpointB.shardName], response, nullptr);
+    ASSERT(!batchOp.isFinished());
+
+    // Only the small write which did not fit into shardA's first batch is left
+    targetedOwned.clear();
+    ASSERT_OK(batchOp.targetBatch(targeter, false, &targeted));
+    ASSERT_EQUALS(targeted.size(), 1u);
+    ASSERT_EQUALS(targeted.begin()->second->getEndpoint().shardName, endpointA.shardName);
+    ASSERT_EQUALS(targeted.begin()->second->getWrites().size(), 1u);
+
+    buildResponse(1, &response);
+    batchOp.noteBatchResponse(*targeted.begin()->second, response, nullptr);
+    ASSERT(batchOp.isFinished());
+
+    BatchedCommandResponse clientResponse;
+    batchOp.buildClientResponse(&clientResponse);
+    ASSERT(clientResponse.getOk());
+    ASSERT_EQUALS(clientResponse.getN(), 4);
+}
+
+// Unordered batch against an unsharded collection - once the only batch is full, later writes
+// which would still fit are left for the next round rather than being targeted out of order
+TEST_F(BatchWriteOpLimitTests, UnorderedFullBatchUnshardedStopsTargeting) {
+    NamespaceString nss("foo.bar");
+    ShardEndpoint endpoint(ShardId("shard"), ChunkVersion::IGNORED());
+
+    // Unsharded collections do not own any chunks
+    class UnshardedMockNSTargeter : public MockNSTargeter {
+    public:
+        using MockNSTargeter::MockNSTargeter;
+
+        int getNShardsOwningChunks() const override {
+            return 0;
+        }
+    };
+
+    UnshardedMockNSTargeter targeter(
+        nss, {MockRange(endpoint, BSON("x" << MINKEY), BSON("x" << MAXKEY))});
+
+    // The first document leaves room for the small one, but not for the medium one
+    const std::string bigString(BSONObjMaxUserSize - 2048, 'x');
+    const std::string mediumString(4096, 'x');
+
+    BatchedCommandRequest request([&] {
+        write_ops::Insert insertOp(nss);
+        insertOp.setWriteCommandBase([] {
+            write_ops::WriteCommandBase wcb;
+            wcb.setOrdered(false);
+            return wcb;
+        }());
+        insertOp.setDocuments({BSON("x" << 1 << "data" << bigString),
+                               BSON("x" << 2 << "data" << mediumString),
+                               BSON("x" << 3)});
+        return insertOp;
+    }());
+
+    BatchWriteOp batchOp(_opCtx, request);
+
+    OwnedPointerMap<ShardId, TargetedWriteBatch> targetedOwned;
+    std::map<ShardId, TargetedWriteBatch*>& targeted = targetedOwned.mutableMap();
+    ASSERT_OK(batchOp.targetBatch(targeter, false, &targeted));
+    ASSERT_EQUALS(targeted.size(), 1u);
+    ASSERT_EQUALS(targeted.begin()->second->getWrites().size(), 1u);
+
+    BatchedCommandResponse response;
+    buildResponse(1, &response);
+    batchOp.noteBatchResponse(*targeted.begin()->second, response, nullptr);
+    ASSERT(!batchOp.isFinished());
+
+    targetedOwned.clear();
+    ASSERT_OK(batchOp.targetBatch(targeter, false, &targeted));
+    ASSERT_EQUALS(targeted.size(), 1u);
+    ASSERT_EQUALS(targeted.begin()->second->getWrites().size(), 2u);
+
+    buildResponse(2, &response);
+    batchOp.noteBatchResponse(*targeted.begin()->second, response, nullptr);
+    ASSERT(batchOp.isFinished());
+
+    BatchedCommandResponse clientResponse;
+    batchOp.buildClientResponse(&clientResponse);
+    ASSERT(clientResponse.getOk());
+    ASSERT_EQUALS(clientResponse.getN(), 3);
+}
+
 class BatchWriteOpTransactionTest : public ShardingTestFixture {
 public:
     const TxnNumber kTxnNumber = 5;
@@ -37,7 +37,9 @@
 
 #include "mongo/db/lasterror.h"
 #include "mongo/s/grid.h"
+#include "mongo/s/query/cluster_find_result_cache.h"
 #include "mongo/s/write_ops/chunk_manager_targeter.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo {
 
@@ -58,6 +60,10 @@ void ClusterWriter::write(OperationContext* opCtx,
     LOGV2_DEBUG_OPTIONS(
         4817400, 2, {logv2::LogComponent::kShardMigrationPerf}, "Starting batch write");
 
+    auto const resultCache = ClusterFindResultCache::get(opCtx);
+    resultCache->onTransactionWrite(opCtx, request.getNS());
+    ON_BLOCK_EXIT([&] { resultCache->onWrite(request.getNS()); });
+
     BatchWriteExec::executeBatch(opCtx, targeter, request, response, stats);
 
     LOGV2_DEBUG_OPTIONS(
@@ -29,6 +29,8 @@
 
 #pragma once
 
+#include <set>
+
 #include "mongo/s/catalog/type_chunk.h"
 #include "mongo/s/ns_targeter.h"
 #include "mongo/unittest/unittest.h"
@@ -123,8 +125,12 @@ public:
     }
 
     int getNShardsOwningChunks() const override {
-        // No-op
-        return 0;
+        std::set<ShardId> shards;
+        for (const auto& range : _mockRanges) {
+            shards.insert(range.endpoint.shardName);
+        }
+
+        return shards.size();
     }
 
 private:
@@ -72,16 +72,16 @@ public:
     }
 
     /**
-     * Pushes all entries.
+     * Pushes all entries, and returns their total size as measured by the size function.
      *
      * If enough space is not available, this method will block.
      *
      * NOTE: Should only be used in a single producer case.
      */
     template <typename Iterator>
-    void pushAllBlocking(Iterator begin, Iterator end) {
+    size_t pushAllBlocking(Iterator begin, Iterator end) {
         if (begin == end) {
-            return;
+            return 0;
         }
 
         size_t size = 0;
@@ -95,16 +95,14 @@ public:
         const auto startedEmpty = _queue.empty();
         _clearing = false;
 
-        auto pushOne = [this](const T& obj) {
-            size_t tSize = _getSize(obj);
-            _queue.push(obj);
-            _currentSize += tSize;
-        };
-        std::for_each(begin, end, pushOne);
+        // The entries were already measured above, so account for them all at once.
+        std::for_each(begin, end, [this](const T& obj) { _queue.push(obj); });
+        _currentSize += size;
 
         if (startedEmpty) {
             _cvNoLongerEmpty.notify_one();
         }
+        return size;
     }
 
     bool empty() const {